@@ -128,8 +128,8 @@
 
 /* Change the Gesture Settings */
 /* Memory Map Position 0x4B - 0x55 */
-#define GESTURE_ENABLE_0                         0x00
-#define GESTURE_ENABLE_1                         0x00
+#define GESTURE_ENABLE_0                         0x0B    // Single tap, double tap, press-and-hold
+#define GESTURE_ENABLE_1                         0x0F    // Swipe X+/X-/Y+/Y-
 #define TAP_TOUCH_TIME_0                         0xC8
 #define TAP_TOUCH_TIME_1                         0x00
 #define TAP_WAIT_TIME_0                          0x96
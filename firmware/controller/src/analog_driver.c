@@ -12,6 +12,8 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/drivers/gpio.h>
 #include <hal/nrf_saadc.h>
+#include <nrfx_timer.h>
+#include <helpers/nrfx_gppi.h>
 #include <math.h>
 #include <stdlib.h>
 
@@ -32,10 +34,67 @@ static const analog_config_t default_config = {
     .resolution_bits = 12,
     .gain = ADC_GAIN_1_6,
     .reference = ADC_REF_INTERNAL,
-    .acquisition_time = ADC_ACQ_TIME(ADC_ACQ_TIME_MICROSECONDS, 40), // Increased for rapidly changing signals
+    .channel_timing = {
+        // Sticks and trigger are low-impedance pots: short acquisition, every buffer
+        [ANALOG_CHANNEL_STICK_X] = { .rate_hz = 500, .acq_time_us = 10, .oversample = 4 },
+        [ANALOG_CHANNEL_STICK_Y] = { .rate_hz = 500, .acq_time_us = 10, .oversample = 4 },
+        [ANALOG_CHANNEL_TRIGGER] = { .rate_hz = 500, .acq_time_us = 10, .oversample = 2 },
+        // Battery sits behind a 1M/510k divider: long acquisition, but main() only reads it every 10s
+        [ANALOG_CHANNEL_BATTERY] = { .rate_hz = 1, .acq_time_us = 40, .oversample = 4 },
+    },
     .filter_alpha = 0.8f // Lighter filtering for better responsiveness
 };
 
+// SAADC acquisition times the hardware supports
+static const struct {
+    uint8_t us;
+    nrf_saadc_acqtime_t hal;
+} acq_times[] = {
+    { 3, NRF_SAADC_ACQTIME_3US },
+    { 5, NRF_SAADC_ACQTIME_5US },
+    { 10, NRF_SAADC_ACQTIME_10US },
+    { 15, NRF_SAADC_ACQTIME_15US },
+    { 20, NRF_SAADC_ACQTIME_20US },
+    { 40, NRF_SAADC_ACQTIME_40US },
+};
+
+// Index of the shortest supported acquisition time that is at least us
+static int analog_acq_time_index(uint8_t us)
+{
+    for (int i = 0; i < ARRAY_SIZE(acq_times); i++)
+    {
+        if (acq_times[i].us >= us)
+        {
+            return i;
+        }
+    }
+    return ARRAY_SIZE(acq_times) - 1;
+}
+
+static uint8_t analog_acq_time_us(uint8_t us)
+{
+    return acq_times[analog_acq_time_index(us)].us;
+}
+
+static nrf_saadc_acqtime_t analog_acq_time_hal(uint8_t us)
+{
+    return acq_times[analog_acq_time_index(us)].hal;
+}
+
+// Blocking single-channel read with the channel's hardware oversampling
+static void analog_sequence_init(int channel, struct adc_sequence *sequence)
+{
+    uint8_t oversample = MAX(g_analog_ctx.config.channel_timing[channel].oversample, 1);
+
+    *sequence = (struct adc_sequence){
+        .buffer = &g_analog_ctx.raw_buffer[channel],
+        .buffer_size = sizeof(int16_t),
+        .resolution = g_analog_ctx.config.resolution_bits,
+        .oversampling = MIN(LOG2(oversample), 8), // SAADC averages 2^n conversions
+        .channels = BIT(g_analog_ctx.channel_configs[channel].adc_channel),
+    };
+}
+
 // Channel names for debugging
 static const char *channel_names[ANALOG_CHANNEL_COUNT] = {
     "STICK_X",
@@ -111,7 +170,8 @@ analog_status_t analog_driver_init(const struct device *adc_device)
 
         cfg->gain = g_analog_ctx.config.gain;
         cfg->reference = g_analog_ctx.config.reference;
-        cfg->acquisition_time = g_analog_ctx.config.acquisition_time;
+        cfg->acquisition_time = ADC_ACQ_TIME(ADC_ACQ_TIME_MICROSECONDS,
+                                             analog_acq_time_us(g_analog_ctx.config.channel_timing[i].acq_time_us));
         cfg->channel_id = ch_cfg->adc_channel;
         cfg->differential = 0;
         cfg->input_positive = ch_cfg->adc_input;
@@ -153,8 +213,7 @@ analog_status_t analog_driver_init(const struct device *adc_device)
     g_analog_ctx.filter_initialized = false;
     g_analog_ctx.sample_count = 0;
     
-    // Initialize thread synchronization
-    k_mutex_init(&g_analog_ctx.data_mutex);
+    // Initialize thread synchronization (data_lock needs no init)
     g_analog_ctx.thread_running = false;
     g_analog_ctx.thread_stop_requested = false;
 
@@ -183,154 +242,168 @@ analog_status_t analog_driver_init(const struct device *adc_device)
 }
 
 /**
- * @brief Read all analog channels and update filtered values
+ * @brief Filter, calibrate and scale one raw reading into channel_data (caller holds data_lock)
  */
-analog_status_t analog_driver_read_all(void)
+static void analog_process_sample(int channel, int16_t raw)
 {
-    if (!g_analog_ctx.initialized)
+    analog_data_t *data = &g_analog_ctx.channel_data[channel];
+    analog_calibration_t *cal = &g_analog_ctx.calibrations[channel];
+
+    // Store raw value
+    data->raw_value = raw;
+
+    // Apply low-pass filtering
+    if (!g_analog_ctx.filter_initialized)
     {
-        return ANALOG_STATUS_NOT_INITIALIZED;
+        // Initialize filter with first reading
+        data->filtered_value = (float)data->raw_value;
+        g_analog_ctx.filter_initialized = true;
     }
-
-    // Read each channel individually
-    for (int i = 0; i < ANALOG_CHANNEL_COUNT; i++)
+    else
     {
-        struct adc_sequence sequence = {
-            .buffer = &g_analog_ctx.raw_buffer[i],
-            .buffer_size = sizeof(int16_t),
-            .resolution = g_analog_ctx.config.resolution_bits,
-            .channels = BIT(g_analog_ctx.channel_configs[i].adc_channel),
-        };
-
-        int ret = adc_read(g_analog_ctx.adc_dev, &sequence);
-        if (ret != 0)
-        {
-            LOG_WRN("ADC read failed for channel %d (%s): %d",
-                    i, g_analog_ctx.channel_configs[i].name, ret);
-            continue;
-        }
-
-        analog_data_t *data = &g_analog_ctx.channel_data[i];
-        analog_calibration_t *cal = &g_analog_ctx.calibrations[i];
+        // Exponential moving average filter
+        float alpha = g_analog_ctx.config.filter_alpha;
+        data->filtered_value = alpha * (float)data->raw_value +
+                               (1.0f - alpha) * data->filtered_value;
+    }
 
-        // Store raw value
-        data->raw_value = g_analog_ctx.raw_buffer[i];
+    // Apply calibration and scaling
+    int16_t calibrated_value = (int16_t)data->filtered_value;
 
-        // Apply low-pass filtering
-        if (!g_analog_ctx.filter_initialized)
-        {
-            // Initialize filter with first reading
-            data->filtered_value = (float)data->raw_value;
-            g_analog_ctx.filter_initialized = true;
+    if (channel == ANALOG_CHANNEL_TRIGGER)
+    {
+        // Simple trigger scaling: map raw value between min/max to 0-255
+        // For your hardware: rest=~1563, pressed=~718
+        // We want: rest→0 (not pressing), pressed→255 (fully pressed)
+        // The trigger is INVERTED: higher raw value = less pressed
+
+        int32_t rest_value = cal->max_value;     // ~1563 (trigger at rest)
+        int32_t pressed_value = cal->min_value;  // ~718 (trigger fully pressed)
+        int32_t current_value = calibrated_value;
+
+        // Deadzone calculations
+        int32_t trigger_range = rest_value - pressed_value; // ~845
+        int32_t bottom_deadzone = cal->deadzone; // 20% of range (~169)
+        int32_t top_deadzone = cal->deadzone / 2; // 10% of range (~84)
+        
+        int32_t scaled;
+        
+        // Check if in bottom deadzone (near rest position)
+        // If current_value is close to rest_value (within bottom_deadzone), snap to 0
+        if (current_value >= (rest_value - bottom_deadzone)) {
+            scaled = 0; // Trigger at rest
         }
-        else
-        {
-            // Exponential moving average filter
-            float alpha = g_analog_ctx.config.filter_alpha;
-            data->filtered_value = alpha * (float)data->raw_value +
-                                   (1.0f - alpha) * data->filtered_value;
+        // Check if in top deadzone (fully pressed)
+        // If current_value is close to pressed_value (within top_deadzone), snap to 255
+        else if (current_value <= (pressed_value + top_deadzone)) {
+            scaled = 255; // Trigger fully pressed
+        }
+        else {
+            // In the active range between deadzones
+            int32_t active_rest = rest_value - bottom_deadzone;
+            int32_t active_pressed = pressed_value + top_deadzone;
+            int32_t active_range = active_rest - active_pressed;
+
+            // Map from active range to 0-255
+            // active_rest → 0, active_pressed → 255
+            scaled = ((active_rest - current_value) * 255) / active_range;
+
+            // Clamp to valid range
+            if (scaled < 0) scaled = 0;
+            if (scaled > 255) scaled = 255;
         }
 
-        // Apply calibration and scaling
-        int16_t calibrated_value = (int16_t)data->filtered_value;
+        data->controller_value.trigger_value = (uint8_t)scaled;
+        data->in_deadzone = (scaled == 0);
+    }
+    else
+    {
+        // Stick: -127 to +127 - scale without per-axis deadzone (will apply square deadzone later)
+        int16_t offset_from_center = calibrated_value - cal->center_value;
+        int32_t scaled = 0;
 
-        if (i == ANALOG_CHANNEL_TRIGGER)
+        if (offset_from_center > 0)
         {
-            // Simple trigger scaling: map raw value between min/max to 0-255
-            // For your hardware: rest=~1563, pressed=~718
-            // We want: rest→0 (not pressing), pressed→255 (fully pressed)
-            // The trigger is INVERTED: higher raw value = less pressed
-
-            int32_t rest_value = cal->max_value;     // ~1563 (trigger at rest)
-            int32_t pressed_value = cal->min_value;  // ~718 (trigger fully pressed)
-            int32_t current_value = calibrated_value;
-
-            // Deadzone calculations
-            int32_t trigger_range = rest_value - pressed_value; // ~845
-            int32_t bottom_deadzone = cal->deadzone; // 20% of range (~169)
-            int32_t top_deadzone = cal->deadzone / 2; // 10% of range (~84)
-            
-            int32_t scaled;
-            
-            // Check if in bottom deadzone (near rest position)
-            // If current_value is close to rest_value (within bottom_deadzone), snap to 0
-            if (current_value >= (rest_value - bottom_deadzone)) {
-                scaled = 0; // Trigger at rest
-            }
-            // Check if in top deadzone (fully pressed)
-            // If current_value is close to pressed_value (within top_deadzone), snap to 255
-            else if (current_value <= (pressed_value + top_deadzone)) {
-                scaled = 255; // Trigger fully pressed
-            }
-            else {
-                // In the active range between deadzones
-                int32_t active_rest = rest_value - bottom_deadzone;
-                int32_t active_pressed = pressed_value + top_deadzone;
-                int32_t active_range = active_rest - active_pressed;
-
-                // Map from active range to 0-255
-                // active_rest → 0, active_pressed → 255
-                scaled = ((active_rest - current_value) * 255) / active_range;
+            // Positive direction - with 5% outer deadzone
+            int32_t total_range = cal->max_value - (cal->center_value + cal->deadzone);
+            int32_t outer_deadzone = total_range * 0.05f;
+            int32_t range = total_range - outer_deadzone;
+            int32_t offset_value = offset_from_center - cal->deadzone;
 
-                // Clamp to valid range
-                if (scaled < 0) scaled = 0;
-                if (scaled > 255) scaled = 255;
+            if (range > 0)
+            {
+                scaled = (offset_value * 127) / range;
             }
 
-            data->controller_value.trigger_value = (uint8_t)scaled;
-            data->in_deadzone = (scaled == 0);
+            if (scaled > 127)
+                scaled = 127;
+            if (scaled < 0)
+                scaled = 0;
         }
         else
         {
-            // Stick: -127 to +127 - scale without per-axis deadzone (will apply square deadzone later)
-            int16_t offset_from_center = calibrated_value - cal->center_value;
-            int32_t scaled = 0;
+            // Negative direction - with 5% outer deadzone
+            int32_t total_range = (cal->center_value - cal->deadzone) - cal->min_value;
+            int32_t outer_deadzone = total_range * 0.05f;
+            int32_t range = total_range - outer_deadzone;
+            int32_t offset_value = abs(offset_from_center) - cal->deadzone;
 
-            if (offset_from_center > 0)
+            if (range > 0)
             {
-                // Positive direction - with 5% outer deadzone
-                int32_t total_range = cal->max_value - (cal->center_value + cal->deadzone);
-                int32_t outer_deadzone = total_range * 0.05f;
-                int32_t range = total_range - outer_deadzone;
-                int32_t offset_value = offset_from_center - cal->deadzone;
+                scaled = -((offset_value * 127) / range);
+            }
 
-                if (range > 0)
-                {
-                    scaled = (offset_value * 127) / range;
-                }
+            if (scaled < -127)
+                scaled = -127;
+            if (scaled > 0)
+                scaled = 0;
+        }
 
-                if (scaled > 127)
-                    scaled = 127;
-                if (scaled < 0)
-                    scaled = 0;
-            }
-            else
-            {
-                // Negative direction - with 5% outer deadzone
-                int32_t total_range = (cal->center_value - cal->deadzone) - cal->min_value;
-                int32_t outer_deadzone = total_range * 0.05f;
-                int32_t range = total_range - outer_deadzone;
-                int32_t offset_value = abs(offset_from_center) - cal->deadzone;
+        // Invert Y axis AFTER scaling (channel 1)
+        if (channel == ANALOG_CHANNEL_STICK_Y) {
+            scaled = -scaled;
+        }
 
-                if (range > 0)
-                {
-                    scaled = -((offset_value * 127) / range);
-                }
+        data->controller_value.stick_value = (int8_t)scaled;
+        data->in_deadzone = false;
+    }
+}
 
-                if (scaled < -127)
-                    scaled = -127;
-                if (scaled > 0)
-                    scaled = 0;
-            }
+/**
+ * @brief Read all analog channels and update filtered values
+ */
+analog_status_t analog_driver_read_all(void)
+{
+    if (!g_analog_ctx.initialized)
+    {
+        return ANALOG_STATUS_NOT_INITIALIZED;
+    }
 
-            // Invert Y axis AFTER scaling (channel 1)
-            if (i == ANALOG_CHANNEL_STICK_Y) {
-                scaled = -scaled;
-            }
+    // DMA scan keeps channel_data current - just wait for the next completed buffer
+    if (g_analog_ctx.dma_running)
+    {
+        k_sleep(K_USEC(ANALOG_DMA_BUFFER_PERIOD_US));
+        g_analog_ctx.sample_count++;
+        return ANALOG_STATUS_OK;
+    }
 
-            data->controller_value.stick_value = (int8_t)scaled;
-            data->in_deadzone = false;
+    // Read each channel individually
+    for (int i = 0; i < ANALOG_CHANNEL_COUNT; i++)
+    {
+        struct adc_sequence sequence;
+        analog_sequence_init(i, &sequence);
+
+        int ret = adc_read(g_analog_ctx.adc_dev, &sequence);
+        if (ret != 0)
+        {
+            LOG_WRN("ADC read failed for channel %d (%s): %d",
+                    i, g_analog_ctx.channel_configs[i].name, ret);
+            continue;
         }
+
+        k_spinlock_key_t key = k_spin_lock(&g_analog_ctx.data_lock);
+        analog_process_sample(i, g_analog_ctx.raw_buffer[i]);
+        k_spin_unlock(&g_analog_ctx.data_lock, key);
     }
 
     g_analog_ctx.sample_count++;
@@ -352,13 +425,15 @@ analog_status_t analog_driver_read_single_channel(analog_channel_id_t channel_id
         return ANALOG_STATUS_INVALID_CHANNEL;
     }
 
+    // DMA scan owns the SAADC and keeps channel_data current - a blocking read would collide with it
+    if (g_analog_ctx.dma_running)
+    {
+        return ANALOG_STATUS_OK;
+    }
+
     // Read only the specified channel
-    struct adc_sequence sequence = {
-        .buffer = &g_analog_ctx.raw_buffer[channel_id],
-        .buffer_size = sizeof(int16_t),
-        .resolution = g_analog_ctx.config.resolution_bits,
-        .channels = BIT(g_analog_ctx.channel_configs[channel_id].adc_channel),
-    };
+    struct adc_sequence sequence;
+    analog_sequence_init(channel_id, &sequence);
 
     int ret = adc_read(g_analog_ctx.adc_dev, &sequence);
     if (ret != 0)
@@ -461,7 +536,7 @@ analog_status_t analog_driver_get_controller_data(analog_controller_data_t *data
     }
 
     // Thread-safe data access
-    k_mutex_lock(&g_analog_ctx.data_mutex, K_FOREVER);
+    k_spinlock_key_t key = k_spin_lock(&g_analog_ctx.data_lock);
     
     int8_t raw_stick_x = g_analog_ctx.channel_data[ANALOG_CHANNEL_STICK_X].controller_value.stick_value;
     int8_t raw_stick_y = g_analog_ctx.channel_data[ANALOG_CHANNEL_STICK_Y].controller_value.stick_value;
@@ -509,7 +584,7 @@ analog_status_t analog_driver_get_controller_data(analog_controller_data_t *data
     
     data->trigger = g_analog_ctx.channel_data[ANALOG_CHANNEL_TRIGGER].controller_value.trigger_value;
     
-    k_mutex_unlock(&g_analog_ctx.data_mutex);
+    k_spin_unlock(&g_analog_ctx.data_lock, key);
 
     return ANALOG_STATUS_OK;
 }
@@ -530,12 +605,12 @@ analog_status_t analog_driver_get_battery_voltage(uint16_t *voltage_mv)
     }
 
     // Thread-safe data access
-    k_mutex_lock(&g_analog_ctx.data_mutex, K_FOREVER);
+    k_spinlock_key_t key = k_spin_lock(&g_analog_ctx.data_lock);
     
     // Get raw ADC value for battery channel
     int16_t raw_value = g_analog_ctx.channel_data[ANALOG_CHANNEL_BATTERY].raw_value;
     
-    k_mutex_unlock(&g_analog_ctx.data_mutex);
+    k_spin_unlock(&g_analog_ctx.data_lock, key);
 
     // Convert to voltage (1/6 gain, 0.6V ref, 12-bit ADC)
     // Voltage at pin = (raw/4095) * 3.6V
@@ -565,6 +640,13 @@ static void adc_thread_function(void *arg1, void *arg2, void *arg3)
     ARG_UNUSED(arg3);
     
     LOG_INF("ADC thread started");
+
+    uint16_t thread_divider[ANALOG_CHANNEL_COUNT];
+    for (int i = 0; i < ANALOG_CHANNEL_COUNT; i++) {
+        uint16_t rate_hz = MAX(g_analog_ctx.config.channel_timing[i].rate_hz, 1);
+        thread_divider[i] = MAX(ANALOG_THREAD_RATE_HZ / rate_hz, 1);
+    }
+    uint32_t pass = 0;
     
     while (!g_analog_ctx.thread_stop_requested) {
         // Read each channel individually to prevent blocking
@@ -572,13 +654,14 @@ static void adc_thread_function(void *arg1, void *arg2, void *arg3)
             if (g_analog_ctx.thread_stop_requested) {
                 break;
             }
+
+            // Slow channels (battery) are only converted on the passes they are due
+            if (pass % thread_divider[i] != 0) {
+                continue;
+            }
             
-            struct adc_sequence sequence = {
-                .buffer = &g_analog_ctx.raw_buffer[i],
-                .buffer_size = sizeof(int16_t),
-                .resolution = g_analog_ctx.config.resolution_bits,
-                .channels = BIT(g_analog_ctx.channel_configs[i].adc_channel),
-            };
+            struct adc_sequence sequence;
+            analog_sequence_init(i, &sequence);
 
             int ret = adc_read(g_analog_ctx.adc_dev, &sequence);
             if (ret != 0) {
@@ -587,106 +670,14 @@ static void adc_thread_function(void *arg1, void *arg2, void *arg3)
                 continue;
             }
             
-            // Process the reading with mutex protection (simple approach)
-            k_mutex_lock(&g_analog_ctx.data_mutex, K_FOREVER);
-            
-            analog_data_t *data = &g_analog_ctx.channel_data[i];
-            analog_calibration_t *cal = &g_analog_ctx.calibrations[i];
-            
-            // Store raw value
-            data->raw_value = g_analog_ctx.raw_buffer[i];
-            
-            // Apply low-pass filtering
-            if (!g_analog_ctx.filter_initialized) {
-                data->filtered_value = (float)data->raw_value;
-                g_analog_ctx.filter_initialized = true;
-            } else {
-                data->filtered_value = g_analog_ctx.config.filter_alpha * (float)data->raw_value +
-                                     (1.0f - g_analog_ctx.config.filter_alpha) * data->filtered_value;
-            }
-            
-            // Apply calibration and scaling
-            int16_t calibrated_value = (int16_t)data->filtered_value;
-
-            if (i == ANALOG_CHANNEL_TRIGGER) {
-                // Trigger scaling with dual deadzones (same logic as analog_driver_read_all)
-                int32_t rest_value = cal->max_value;     // ~1563 (trigger at rest)
-                int32_t pressed_value = cal->min_value;  // ~718 (trigger fully pressed)
-                int32_t current_value = calibrated_value;
-
-                // Deadzone calculations
-                int32_t trigger_range = rest_value - pressed_value;
-                int32_t bottom_deadzone = cal->deadzone;     // 20% of range
-                int32_t top_deadzone = cal->deadzone / 2;    // 10% of range
-                
-                int32_t scaled;
-                
-                // Bottom deadzone (near rest position)
-                if (current_value >= (rest_value - bottom_deadzone)) {
-                    scaled = 0; // Trigger at rest
-                }
-                // Top deadzone (fully pressed)
-                else if (current_value <= (pressed_value + top_deadzone)) {
-                    scaled = 255; // Trigger fully pressed
-                }
-                else {
-                    // Active range between deadzones
-                    int32_t active_rest = rest_value - bottom_deadzone;
-                    int32_t active_pressed = pressed_value + top_deadzone;
-                    int32_t active_range = active_rest - active_pressed;
-
-                    // Map from active range to 0-255
-                    scaled = ((active_rest - current_value) * 255) / active_range;
-
-                    // Clamp to valid range
-                    if (scaled < 0) scaled = 0;
-                    if (scaled > 255) scaled = 255;
-                }
-
-                data->controller_value.trigger_value = (uint8_t)scaled;
-                data->in_deadzone = (scaled == 0);
-            } else {
-                // Stick scaling without per-axis deadzone (will apply square deadzone later)
-                int16_t offset_from_center = calibrated_value - cal->center_value;
-                int32_t scaled = 0;
-                
-                if (offset_from_center > 0) {
-                    // Positive direction - with 5% outer deadzone
-                    int32_t total_range = cal->max_value - (cal->center_value + cal->deadzone);
-                    int32_t outer_deadzone = total_range * 0.05f;
-                    int32_t range = total_range - outer_deadzone;
-                    int32_t offset_value = offset_from_center - cal->deadzone;
-                    if (range > 0) {
-                        scaled = (offset_value * 127) / range;
-                    }
-                    if (scaled > 127) scaled = 127;
-                    if (scaled < 0) scaled = 0;
-                } else {
-                    // Negative direction - with 5% outer deadzone
-                    int32_t total_range = (cal->center_value - cal->deadzone) - cal->min_value;
-                    int32_t outer_deadzone = total_range * 0.05f;
-                    int32_t range = total_range - outer_deadzone;
-                    int32_t offset_value = abs(offset_from_center) - cal->deadzone;
-                    if (range > 0) {
-                        scaled = -((offset_value * 127) / range);
-                    }
-                    if (scaled < -127) scaled = -127;
-                    if (scaled > 0) scaled = 0;
-                }
-                
-                // Invert Y axis AFTER scaling
-                if (i == ANALOG_CHANNEL_STICK_Y) {
-                    scaled = -scaled;
-                }
-                
-                data->controller_value.stick_value = (int8_t)scaled;
-                data->in_deadzone = false;
-            }
-            
-            k_mutex_unlock(&g_analog_ctx.data_mutex);
+            // Process the reading under the data lock
+            k_spinlock_key_t key = k_spin_lock(&g_analog_ctx.data_lock);
+            analog_process_sample(i, g_analog_ctx.raw_buffer[i]);
+            k_spin_unlock(&g_analog_ctx.data_lock, key);
         }
         
         g_analog_ctx.sample_count++;
+        pass++;
         
         // Debug logging every 500 samples (about every 2 seconds at 250Hz)
         static uint32_t debug_counter = 0;
@@ -696,8 +687,8 @@ static void adc_thread_function(void *arg1, void *arg2, void *arg3)
             debug_counter = 0;
         }
 
-        // Sleep for 2ms between complete readings (500Hz effective rate - stable and conservative)
-        k_msleep(2);
+        // Sleep between passes (500Hz effective rate - stable and conservative)
+        k_msleep(1000 / ANALOG_THREAD_RATE_HZ);
     }
     
     LOG_INF("ADC thread stopped");
@@ -764,6 +755,438 @@ analog_status_t analog_driver_stop_thread(void)
     return ANALOG_STATUS_OK;
 }
 
+/*
+ * DMA scan mode
+ *
+ * Each TIMER3 period triggers one SAADC scan through PPI (CC0), then counts it on TIMER4
+ * once the scan has settled (CC1). EasyDMA appends every scan to the active buffer and
+ * SAADC END restarts the SAADC through PPI, latching the next buffer, so sampling never
+ * waits for the CPU. TIMER4 interrupts after the last scan of each buffer: the handler
+ * queues the buffer after the one END just started and processes the completed one.
+ *
+ * Only channels due at least once per buffer join the scan, and that set is fixed for the
+ * session, so a late interrupt can't shift the interleave. Slow channels such as the
+ * battery divider stay disconnected: a delayed work item pauses the scan when one is due
+ * and reads it with a single blocking conversion. Three buffers rotate so the one being
+ * processed is never the one DMA is writing or about to write.
+ */
+#define ANALOG_DMA_BUFFER_COUNT 3
+#define ANALOG_DMA_BUFFER_LEN   (ANALOG_DMA_SCANS_PER_BUFFER * ANALOG_CHANNEL_COUNT)
+#define ANALOG_DMA_PERIOD_US    (1000000 / ANALOG_DMA_SAMPLE_RATE_HZ)
+#define ANALOG_DMA_SETTLE_US    (ANALOG_DMA_PERIOD_US - 100) // Scan done, counted before the next period
+#define ANALOG_DMA_BUFFER_RATE_HZ (ANALOG_DMA_SAMPLE_RATE_HZ / ANALOG_DMA_SCANS_PER_BUFFER)
+
+static const nrfx_timer_t dma_sample_timer = NRFX_TIMER_INSTANCE(3);
+static const nrfx_timer_t dma_scan_counter = NRFX_TIMER_INSTANCE(4);
+static nrf_saadc_value_t dma_buffers[ANALOG_DMA_BUFFER_COUNT][ANALOG_DMA_BUFFER_LEN];
+static uint8_t dma_scan_mask;          // Channels converted by every timer-triggered scan
+static uint8_t dma_slow_mask;          // Channels read one at a time by dma_slow_work
+static uint32_t dma_slow_period_ms[ANALOG_CHANNEL_COUNT];
+static uint32_t dma_slow_next_ms[ANALOG_CHANNEL_COUNT];  // Uptime a slow channel is due next
+static struct k_work_delayable dma_slow_work;
+static uint8_t dma_done_idx;           // Buffer that completes at the next interrupt
+static uint8_t dma_ppi_sample;         // TIMER3 COMPARE0 -> SAADC SAMPLE
+static uint8_t dma_ppi_count;          // TIMER3 COMPARE1 -> TIMER4 COUNT
+static uint8_t dma_ppi_restart;        // SAADC END -> SAADC START
+static uint32_t dma_saved_inten;       // SAADC interrupts owned by the Zephyr ADC driver
+static bool dma_timers_ready;
+
+/**
+ * @brief Connect only the channels in mask to the SAADC scan
+ */
+static void analog_dma_apply_inputs(uint8_t mask)
+{
+    for (int ch = 0; ch < ANALOG_CHANNEL_COUNT; ch++)
+    {
+        const analog_channel_config_t *ch_cfg = &g_analog_ctx.channel_configs[ch];
+        nrf_saadc_channel_input_set(NRF_SAADC, ch_cfg->adc_channel,
+                                    (mask & BIT(ch)) ? ch_cfg->adc_input : NRF_SAADC_INPUT_DISABLED,
+                                    NRF_SAADC_INPUT_DISABLED);
+    }
+}
+
+/**
+ * @brief Queue a buffer sized for the scan set
+ */
+static void analog_dma_queue_buffer(uint8_t idx)
+{
+    nrf_saadc_buffer_init(NRF_SAADC, dma_buffers[idx], ANALOG_DMA_SCANS_PER_BUFFER * POPCOUNT(dma_scan_mask));
+}
+
+/**
+ * @brief Average a completed buffer per channel and publish it
+ */
+static void analog_dma_process_buffer(const nrf_saadc_value_t *buffer)
+{
+    uint8_t mask = dma_scan_mask;
+    uint8_t stride = POPCOUNT(mask);
+    int32_t readings[ANALOG_CHANNEL_COUNT];
+
+    // Scan results are interleaved in channel order; average each channel's newest scans
+    for (int ch = 0; ch < ANALOG_CHANNEL_COUNT; ch++)
+    {
+        if (!(mask & BIT(ch)))
+        {
+            continue;
+        }
+
+        uint8_t slot = POPCOUNT(mask & (BIT(ch) - 1));
+        uint8_t count = MIN(g_analog_ctx.config.channel_timing[ch].oversample, ANALOG_DMA_SCANS_PER_BUFFER);
+        count = MAX(count, 1);
+        int32_t sum = 0;
+
+        for (int scan = ANALOG_DMA_SCANS_PER_BUFFER - count; scan < ANALOG_DMA_SCANS_PER_BUFFER; scan++)
+        {
+            sum += buffer[scan * stride + slot];
+        }
+        readings[ch] = MAX(sum / count, 0); // Single-ended noise can read slightly negative
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&g_analog_ctx.data_lock);
+    for (int ch = 0; ch < ANALOG_CHANNEL_COUNT; ch++)
+    {
+        if (mask & BIT(ch))
+        {
+            analog_process_sample(ch, (int16_t)readings[ch]);
+        }
+    }
+    k_spin_unlock(&g_analog_ctx.data_lock, key);
+
+    g_analog_ctx.sample_count++;
+}
+
+/**
+ * @brief TIMER4 compare handler - the last scan of a buffer has completed
+ */
+static void analog_dma_buffer_handler(nrf_timer_event_t event_type, void *p_context)
+{
+    ARG_UNUSED(p_context);
+
+    if (event_type != NRF_TIMER_EVENT_COMPARE0 || !g_analog_ctx.dma_running)
+    {
+        return;
+    }
+
+    uint8_t done = dma_done_idx;
+    uint8_t started = (done + 1) % ANALOG_DMA_BUFFER_COUNT;
+    uint8_t queued = (done + 2) % ANALOG_DMA_BUFFER_COUNT;
+
+    // END latched the next buffer already - queue the one after it
+    analog_dma_queue_buffer(queued);
+    dma_done_idx = started;
+
+    analog_dma_process_buffer(dma_buffers[done]);
+    g_analog_ctx.dma_buffers_done++;
+}
+
+/**
+ * @brief TIMER3 only drives PPI - no interrupts are enabled
+ */
+static void analog_dma_sample_timer_handler(nrf_timer_event_t event_type, void *p_context)
+{
+    ARG_UNUSED(event_type);
+    ARG_UNUSED(p_context);
+}
+
+/**
+ * @brief One-time setup of the sample timer, scan counter and PPI channels
+ */
+static analog_status_t analog_dma_init_hw(void)
+{
+    if (dma_timers_ready)
+    {
+        return ANALOG_STATUS_OK;
+    }
+
+    IRQ_CONNECT(TIMER3_IRQn, DT_IRQ(DT_NODELABEL(timer3), priority), nrfx_isr, nrfx_timer_3_irq_handler, 0);
+    IRQ_CONNECT(TIMER4_IRQn, DT_IRQ(DT_NODELABEL(timer4), priority), nrfx_isr, nrfx_timer_4_irq_handler, 0);
+
+    nrfx_timer_config_t sample_cfg = NRFX_TIMER_DEFAULT_CONFIG(1000000);
+    sample_cfg.bit_width = NRF_TIMER_BIT_WIDTH_32;
+    if (nrfx_timer_init(&dma_sample_timer, &sample_cfg, analog_dma_sample_timer_handler) != NRFX_SUCCESS)
+    {
+        LOG_ERR("Failed to init ADC sample timer");
+        return ANALOG_STATUS_ERROR;
+    }
+
+    nrfx_timer_config_t counter_cfg = NRFX_TIMER_DEFAULT_CONFIG(1000000);
+    counter_cfg.mode = NRF_TIMER_MODE_COUNTER;
+    counter_cfg.bit_width = NRF_TIMER_BIT_WIDTH_16;
+    if (nrfx_timer_init(&dma_scan_counter, &counter_cfg, analog_dma_buffer_handler) != NRFX_SUCCESS)
+    {
+        LOG_ERR("Failed to init ADC scan counter");
+        nrfx_timer_uninit(&dma_sample_timer);
+        return ANALOG_STATUS_ERROR;
+    }
+
+    if (nrfx_gppi_channel_alloc(&dma_ppi_sample) != NRFX_SUCCESS ||
+        nrfx_gppi_channel_alloc(&dma_ppi_count) != NRFX_SUCCESS ||
+        nrfx_gppi_channel_alloc(&dma_ppi_restart) != NRFX_SUCCESS)
+    {
+        LOG_ERR("Failed to allocate PPI channels for ADC");
+        nrfx_timer_uninit(&dma_scan_counter);
+        nrfx_timer_uninit(&dma_sample_timer);
+        return ANALOG_STATUS_ERROR;
+    }
+
+    // Each period: scan at CC0, count the settled scan at CC1, wrap at CC2
+    nrfx_timer_compare(&dma_sample_timer, NRF_TIMER_CC_CHANNEL0, 1, false);
+    nrfx_timer_compare(&dma_sample_timer, NRF_TIMER_CC_CHANNEL1,
+                       nrfx_timer_us_to_ticks(&dma_sample_timer, ANALOG_DMA_SETTLE_US), false);
+    nrfx_timer_extended_compare(&dma_sample_timer, NRF_TIMER_CC_CHANNEL2,
+                                nrfx_timer_us_to_ticks(&dma_sample_timer, ANALOG_DMA_PERIOD_US),
+                                NRF_TIMER_SHORT_COMPARE2_CLEAR_MASK, false);
+
+    // Scan counter wraps and interrupts once per buffer
+    nrfx_timer_extended_compare(&dma_scan_counter, NRF_TIMER_CC_CHANNEL0, ANALOG_DMA_SCANS_PER_BUFFER,
+                                NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK, true);
+
+    nrfx_gppi_channel_endpoints_setup(dma_ppi_sample,
+                                      nrfx_timer_compare_event_address_get(&dma_sample_timer, NRF_TIMER_CC_CHANNEL0),
+                                      nrf_saadc_task_address_get(NRF_SAADC, NRF_SAADC_TASK_SAMPLE));
+    nrfx_gppi_channel_endpoints_setup(dma_ppi_count,
+                                      nrfx_timer_compare_event_address_get(&dma_sample_timer, NRF_TIMER_CC_CHANNEL1),
+                                      nrfx_timer_task_address_get(&dma_scan_counter, NRF_TIMER_TASK_COUNT));
+    nrfx_gppi_channel_endpoints_setup(dma_ppi_restart,
+                                      nrf_saadc_event_address_get(NRF_SAADC, NRF_SAADC_EVENT_END),
+                                      nrf_saadc_task_address_get(NRF_SAADC, NRF_SAADC_TASK_START));
+
+    dma_timers_ready = true;
+    return ANALOG_STATUS_OK;
+}
+
+/**
+ * @brief Take the SAADC from the Zephyr driver and start timer-triggered scans of dma_scan_mask
+ */
+static void analog_dma_hw_start(void)
+{
+    // Keep the Zephyr ADC driver's ISR away from our END events
+    dma_saved_inten = nrf_saadc_int_enable_check(NRF_SAADC, NRF_SAADC_INT_ALL);
+    nrf_saadc_int_disable(NRF_SAADC, NRF_SAADC_INT_ALL);
+
+    // Per-channel acquisition time; only the scan set gets its input connected
+    for (int i = 0; i < ANALOG_CHANNEL_COUNT; i++)
+    {
+        nrf_saadc_channel_config_t cfg = {
+            .resistor_p = NRF_SAADC_RESISTOR_DISABLED,
+            .resistor_n = NRF_SAADC_RESISTOR_DISABLED,
+            .gain = NRF_SAADC_GAIN1_6,
+            .reference = NRF_SAADC_REFERENCE_INTERNAL,
+            .acq_time = analog_acq_time_hal(g_analog_ctx.config.channel_timing[i].acq_time_us),
+            .mode = NRF_SAADC_MODE_SINGLE_ENDED,
+            .burst = NRF_SAADC_BURST_DISABLED,
+        };
+        nrf_saadc_channel_init(NRF_SAADC, g_analog_ctx.channel_configs[i].adc_channel, &cfg);
+    }
+    analog_dma_apply_inputs(dma_scan_mask);
+    nrf_saadc_resolution_set(NRF_SAADC, NRF_SAADC_RESOLUTION_12BIT);
+    nrf_saadc_oversample_set(NRF_SAADC, NRF_SAADC_OVERSAMPLE_DISABLED);
+    nrf_saadc_continuous_mode_disable(NRF_SAADC);
+    nrf_saadc_enable(NRF_SAADC);
+
+    // Start DMA into the first buffer before any scan can be triggered, then queue the second
+    dma_done_idx = 0;
+    nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STARTED);
+    nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_END);
+    analog_dma_queue_buffer(0);
+    nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_START);
+
+    uint32_t timeout = 100;
+    while (!nrf_saadc_event_check(NRF_SAADC, NRF_SAADC_EVENT_STARTED) && timeout-- > 0)
+    {
+        k_busy_wait(1);
+    }
+    nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STARTED);
+    analog_dma_queue_buffer(1);
+
+    nrfx_gppi_channels_enable(BIT(dma_ppi_sample) | BIT(dma_ppi_count) | BIT(dma_ppi_restart));
+    nrfx_timer_clear(&dma_scan_counter);
+    nrfx_timer_enable(&dma_scan_counter);
+    nrfx_timer_clear(&dma_sample_timer);
+    nrfx_timer_enable(&dma_sample_timer);
+}
+
+/**
+ * @brief Stop the scan timers and hand the SAADC back to the Zephyr ADC driver
+ */
+static void analog_dma_hw_stop(void)
+{
+    nrfx_timer_disable(&dma_sample_timer);
+    nrfx_timer_disable(&dma_scan_counter);
+    nrfx_gppi_channels_disable(BIT(dma_ppi_sample) | BIT(dma_ppi_count) | BIT(dma_ppi_restart));
+
+    nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STOPPED);
+    nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_STOP);
+    uint32_t timeout = 100;
+    while (!nrf_saadc_event_check(NRF_SAADC, NRF_SAADC_EVENT_STOPPED) && timeout-- > 0)
+    {
+        k_busy_wait(1);
+    }
+
+    // Leave no pending events or connected inputs behind for the Zephyr driver
+    analog_dma_apply_inputs(0);
+    nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STARTED);
+    nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_END);
+    nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STOPPED);
+    nrf_saadc_disable(NRF_SAADC);
+    nrf_saadc_int_enable(NRF_SAADC, dma_saved_inten);
+}
+
+/**
+ * @brief Read the slow channels that are due with the scan paused, then resume it
+ */
+static void analog_dma_slow_work_handler(struct k_work *work)
+{
+    ARG_UNUSED(work);
+
+    if (!g_analog_ctx.dma_running)
+    {
+        return;
+    }
+
+    // One blocking conversion per due channel - the scan misses a buffer or so while paused
+    uint32_t now = k_uptime_get_32();
+    analog_dma_hw_stop();
+    for (int ch = 0; ch < ANALOG_CHANNEL_COUNT; ch++)
+    {
+        if (!(dma_slow_mask & BIT(ch)) || (int32_t)(now - dma_slow_next_ms[ch]) < 0)
+        {
+            continue;
+        }
+        dma_slow_next_ms[ch] = now + dma_slow_period_ms[ch];
+
+        struct adc_sequence sequence;
+        analog_sequence_init(ch, &sequence);
+        int ret = adc_read(g_analog_ctx.adc_dev, &sequence);
+        if (ret != 0)
+        {
+            LOG_WRN("ADC read failed for channel %d (%s): %d", ch, g_analog_ctx.channel_configs[ch].name, ret);
+            continue;
+        }
+
+        k_spinlock_key_t key = k_spin_lock(&g_analog_ctx.data_lock);
+        analog_process_sample(ch, g_analog_ctx.raw_buffer[ch]);
+        k_spin_unlock(&g_analog_ctx.data_lock, key);
+    }
+    analog_dma_hw_start();
+
+    // Sleep until the next slow channel is due
+    int32_t wait_ms = INT32_MAX;
+    for (int ch = 0; ch < ANALOG_CHANNEL_COUNT; ch++)
+    {
+        if (dma_slow_mask & BIT(ch))
+        {
+            wait_ms = MIN(wait_ms, MAX((int32_t)(dma_slow_next_ms[ch] - now), 0));
+        }
+    }
+    k_work_reschedule(&dma_slow_work, K_MSEC(wait_ms));
+}
+
+/**
+ * @brief Switch to timer-triggered SAADC scanning with EasyDMA
+ */
+analog_status_t analog_driver_start_dma_scan(void)
+{
+    if (!g_analog_ctx.initialized)
+    {
+        return ANALOG_STATUS_NOT_INITIALIZED;
+    }
+
+    if (g_analog_ctx.dma_running)
+    {
+        return ANALOG_STATUS_OK;
+    }
+
+    // Channels due every buffer join the scan, slower ones are read on their own period.
+    // A full scan must finish before the settle point or it would be counted while still converting
+    uint32_t scan_time_us = 0;
+    dma_scan_mask = 0;
+    dma_slow_mask = 0;
+    for (int i = 0; i < ANALOG_CHANNEL_COUNT; i++)
+    {
+        const analog_channel_timing_t *timing = &g_analog_ctx.config.channel_timing[i];
+        if (timing->rate_hz >= ANALOG_DMA_BUFFER_RATE_HZ)
+        {
+            dma_scan_mask |= BIT(i);
+            scan_time_us += analog_acq_time_us(timing->acq_time_us) + ANALOG_CONVERSION_TIME_US;
+        }
+        else
+        {
+            dma_slow_mask |= BIT(i);
+            dma_slow_period_ms[i] = 1000 / MAX(timing->rate_hz, 1);
+            dma_slow_next_ms[i] = k_uptime_get_32(); // Read once right away
+        }
+    }
+    if (dma_scan_mask == 0)
+    {
+        LOG_ERR("No ADC channel is fast enough for the DMA scan");
+        return ANALOG_STATUS_ERROR;
+    }
+    if (scan_time_us >= ANALOG_DMA_SETTLE_US)
+    {
+        LOG_ERR("ADC scan takes %uus, too long for %d Hz", scan_time_us, ANALOG_DMA_SAMPLE_RATE_HZ);
+        return ANALOG_STATUS_ERROR;
+    }
+
+    // The SAADC can only have one owner - stop blocking reads first
+    if (analog_driver_stop_thread() != ANALOG_STATUS_OK)
+    {
+        return ANALOG_STATUS_ERROR;
+    }
+
+    analog_status_t status = analog_dma_init_hw();
+    if (status != ANALOG_STATUS_OK)
+    {
+        return status;
+    }
+
+    g_analog_ctx.dma_buffers_done = 0;
+    g_analog_ctx.dma_running = true;
+    analog_dma_hw_start();
+
+    if (dma_slow_mask)
+    {
+        k_work_init_delayable(&dma_slow_work, analog_dma_slow_work_handler);
+        k_work_reschedule(&dma_slow_work, K_NO_WAIT);
+    }
+
+    LOG_INF("ADC DMA scan started: %d Hz, %d scans per buffer, scan %uus, slow channels 0x%02x",
+            ANALOG_DMA_SAMPLE_RATE_HZ, ANALOG_DMA_SCANS_PER_BUFFER, scan_time_us, dma_slow_mask);
+    return ANALOG_STATUS_OK;
+}
+
+/**
+ * @brief Stop DMA scanning and hand the SAADC back to the Zephyr ADC driver
+ */
+analog_status_t analog_driver_stop_dma_scan(void)
+{
+    if (!g_analog_ctx.dma_running)
+    {
+        return ANALOG_STATUS_OK;
+    }
+
+    // A slow read in progress restarts the scan on its way out - let it finish first
+    if (dma_slow_mask)
+    {
+        struct k_work_sync sync;
+        k_work_cancel_delayable_sync(&dma_slow_work, &sync);
+    }
+
+    g_analog_ctx.dma_running = false;
+    analog_dma_hw_stop();
+
+    LOG_INF("ADC DMA scan stopped after %u buffers", g_analog_ctx.dma_buffers_done);
+    return ANALOG_STATUS_OK;
+}
+
+/**
+ * @brief Check if DMA scanning is active
+ */
+bool analog_driver_is_dma_scan_active(void)
+{
+    return g_analog_ctx.dma_running;
+}
+
 /**
  * @brief Get raw ADC value for a specific channel
  */
@@ -23,6 +23,16 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+// DMA scan mode: a timer triggers SAADC scans of the fast channels through PPI and EasyDMA
+// fills rotating buffers; the CPU only runs once per completed buffer. Slow channels are
+// read on their own period with the scan briefly paused.
+#define ANALOG_DMA_SAMPLE_RATE_HZ   2000    // Scans per second (every fast channel per scan)
+#define ANALOG_DMA_SCANS_PER_BUFFER 4       // Scans per buffer - caps per-channel oversampling in DMA mode
+#define ANALOG_DMA_BUFFER_PERIOD_US (ANALOG_DMA_SCANS_PER_BUFFER * 1000000 / ANALOG_DMA_SAMPLE_RATE_HZ)
+
+#define ANALOG_THREAD_RATE_HZ       500     // Passes per second in blocking thread mode
+#define ANALOG_CONVERSION_TIME_US   2       // SAADC conversion time added to each channel's acquisition
+
 // Analog status enumeration
 typedef enum {
     ANALOG_STATUS_OK = 0,
@@ -69,12 +79,19 @@ typedef struct {
     bool in_deadzone;           // True if value is within deadzone
 } analog_data_t;
 
+// Per-channel sampling schedule
+typedef struct {
+    uint16_t rate_hz;           // Readings per second - in DMA mode below the buffer rate means read on its own
+    uint8_t acq_time_us;        // SAADC acquisition time, rounded up to 3/5/10/15/20/40us
+    uint8_t oversample;         // Conversions averaged per reading (power of two)
+} analog_channel_timing_t;
+
 // Analog driver configuration
 typedef struct {
     uint16_t resolution_bits;   // ADC resolution (e.g., 12)
     uint32_t gain;              // ADC gain setting
     uint32_t reference;         // ADC reference voltage
-    uint32_t acquisition_time;  // ADC acquisition time
+    analog_channel_timing_t channel_timing[ANALOG_CHANNEL_COUNT];
     float filter_alpha;         // Low-pass filter coefficient (0.0-1.0)
 } analog_config_t;
 
@@ -94,9 +111,13 @@ typedef struct {
     // Thread-based ADC reading
     struct k_thread adc_thread_data;
     k_tid_t adc_thread_tid;
-    struct k_mutex data_mutex;  // Protect channel_data access
+    struct k_spinlock data_lock; // Protect channel_data access (taken from the DMA ISR too)
     bool thread_running;
     bool thread_stop_requested;
+
+    // Timer/PPI-triggered DMA scanning
+    bool dma_running;
+    uint32_t dma_buffers_done;  // Completed DMA buffers published
 } analog_driver_context_t;
 
 // Controller analog data structure (matches main.c format)
@@ -127,6 +148,24 @@ analog_status_t analog_driver_start_thread(void);
  */
 analog_status_t analog_driver_stop_thread(void);
 
+/**
+ * @brief Start timer-triggered SAADC scanning into DMA buffers (replaces the ADC thread)
+ * @return analog_status_t Status of start operation
+ */
+analog_status_t analog_driver_start_dma_scan(void);
+
+/**
+ * @brief Stop DMA scanning and return the SAADC to blocking reads
+ * @return analog_status_t Status of stop operation
+ */
+analog_status_t analog_driver_stop_dma_scan(void);
+
+/**
+ * @brief Check if DMA scanning is active
+ * @return bool True while the SAADC is scanning into DMA buffers
+ */
+bool analog_driver_is_dma_scan_active(void);
+
 /**
  * @brief Get controller-format analog data (thread-safe)
  * @param data Pointer to analog_controller_data_t structure to fill
@@ -17,6 +17,11 @@ LOG_MODULE_REGISTER(button_driver, LOG_LEVEL_ERR);
 // Global context
 static button_driver_context_t g_button_ctx = {0};
 
+// Remap lookup tables, rebuilt only when bindings change: each byte of the
+// physical input word indexes a table holding the remapped 16-bit word
+static uint16_t g_remap_buttons_lut[256];
+static uint16_t g_remap_flags_lut[128];
+
 // Button name strings for debugging
 static const char *button_names[BUTTON_COUNT] = {
     "STICK_CLICK",
@@ -31,6 +36,187 @@ static const char *button_names[BUTTON_COUNT] = {
     "DPAD_UP",
     "PAD_CLICK"};
 
+// Position of each button in the physical input word: bits 0-7 = buttons byte, bits 8-15 = flags byte
+static const uint16_t button_word_bits[BUTTON_COUNT] = {
+    [BUTTON_STICK_CLICK] = 0x0020,
+    [BUTTON_BUMPER] = 0x0010,
+    [BUTTON_START] = 0x0080,
+    [BUTTON_P4] = 0x0200,
+    [BUTTON_P5] = 0x0100,
+    [BUTTON_MODE] = 0x4000,
+    [BUTTON_DPAD_DOWN] = 0x0008,
+    [BUTTON_DPAD_LEFT] = 0x0002,
+    [BUTTON_DPAD_RIGHT] = 0x0004,
+    [BUTTON_DPAD_UP] = 0x0001,
+    [BUTTON_PAD_CLICK] = 0x0040};
+
+/**
+ * @brief Pressed state of every button from one input register read per port
+ */
+uint16_t button_driver_read_snapshot(void)
+{
+    uint32_t levels[BUTTON_MAX_PORTS] = {0};
+    uint16_t pressed = 0;
+
+    for (int port = 0; port < g_button_ctx.port_count; port++)
+    {
+        gpio_port_value_t raw = 0;
+        gpio_port_get_raw(g_button_ctx.port_dev[port], &raw);
+        levels[port] = raw ^ g_button_ctx.port_invert[port];
+    }
+
+    for (int i = 0; i < BUTTON_COUNT; i++)
+    {
+        pressed |= (uint16_t)(((levels[g_button_ctx.button_port[i]] >> g_button_ctx.button_pin[i]) & 1U) << i);
+    }
+
+    return pressed;
+}
+
+/**
+ * @brief Take a new debounced level and start the lockout - caller holds the lock
+ */
+static void button_accept_edge(int button, bool pressed, uint32_t edge_cycles, uint32_t now)
+{
+    if (pressed)
+    {
+        g_button_ctx.debounced_mask |= BIT(button);
+        g_button_ctx.press_latch |= BIT(button);
+    }
+    else
+    {
+        g_button_ctx.debounced_mask &= ~BIT(button);
+    }
+    g_button_ctx.button_states[button].edge_cycles = edge_cycles;
+    g_button_ctx.lockout_mask |= BIT(button);
+    g_button_ctx.lockout_start[button] = now;
+    g_button_ctx.edge_count++;
+
+    // Timer already running belongs to an earlier lockout and fires first - it re-arms for the rest
+    if (k_timer_remaining_get(&g_button_ctx.debounce_timer) == 0)
+    {
+        k_timer_start(&g_button_ctx.debounce_timer, K_USEC(BUTTON_DEBOUNCE_US), K_NO_WAIT);
+    }
+}
+
+/**
+ * @brief Run one observed edge through the debounce state machine - caller holds the lock
+ * @return true if the debounced state changed
+ */
+static bool button_debounce_edge(int button, uint32_t now, uint16_t snapshot)
+{
+    if (g_button_ctx.lockout_mask & BIT(button))
+    {
+        // Bounce - the level is settled when the lockout ends
+        g_button_ctx.last_raw_edge[button] = now;
+        g_button_ctx.bounce_count++;
+        return false;
+    }
+
+    bool pressed = (snapshot & BIT(button)) != 0;
+    if (pressed == ((g_button_ctx.debounced_mask & BIT(button)) != 0))
+    {
+        return false; // Glitch shorter than the interrupt latency
+    }
+
+    g_button_ctx.last_raw_edge[button] = now;
+    button_accept_edge(button, pressed, now, now);
+    return true;
+}
+
+/**
+ * @brief Notify the registered listener of a debounced change
+ */
+static void button_notify_change(uint16_t pressed_mask, uint32_t edge_cycles)
+{
+    button_change_callback_t callback = g_button_ctx.change_cb;
+
+    if (callback)
+    {
+        callback(pressed_mask, edge_cycles);
+    }
+}
+
+/**
+ * @brief GPIO edge interrupt - timestamp first, then debounce every button that fired
+ */
+static void button_gpio_callback(const struct device *dev, struct gpio_callback *cb, uint32_t pins)
+{
+    uint32_t now = k_cycle_get_32();
+    uint16_t snapshot = button_driver_read_snapshot();
+    bool changed = false;
+
+    k_spinlock_key_t key = k_spin_lock(&g_button_ctx.lock);
+    for (int i = 0; i < BUTTON_COUNT; i++)
+    {
+        const struct gpio_dt_spec *spec = g_button_ctx.button_configs[i].gpio_spec;
+        if (spec->port == dev && (pins & BIT(spec->pin)))
+        {
+            changed |= button_debounce_edge(i, now, snapshot);
+        }
+    }
+    uint16_t pressed_mask = g_button_ctx.debounced_mask;
+    k_spin_unlock(&g_button_ctx.lock, key);
+
+    if (changed)
+    {
+        button_notify_change(pressed_mask, now);
+    }
+}
+
+/**
+ * @brief Debounce lockout expiry - settle the level of every button whose lockout ended
+ */
+static void button_debounce_timer_handler(struct k_timer *timer)
+{
+    ARG_UNUSED(timer);
+
+    uint32_t now = k_cycle_get_32();
+    uint16_t snapshot = button_driver_read_snapshot();
+    uint32_t next_us = UINT32_MAX;
+    uint32_t edge_cycles = now;
+    bool changed = false;
+
+    k_spinlock_key_t key = k_spin_lock(&g_button_ctx.lock);
+    for (int i = 0; i < BUTTON_COUNT; i++)
+    {
+        if (!(g_button_ctx.lockout_mask & BIT(i)))
+        {
+            continue;
+        }
+
+        uint32_t elapsed_us = k_cyc_to_us_floor32(now - g_button_ctx.lockout_start[i]);
+        if (elapsed_us < BUTTON_DEBOUNCE_US)
+        {
+            next_us = MIN(next_us, BUTTON_DEBOUNCE_US - elapsed_us);
+            continue;
+        }
+
+        g_button_ctx.lockout_mask &= ~BIT(i);
+
+        // Level moved during the lockout (e.g. a short tap) - its last edge is the best timestamp
+        bool pressed = (snapshot & BIT(i)) != 0;
+        if (pressed != ((g_button_ctx.debounced_mask & BIT(i)) != 0))
+        {
+            edge_cycles = g_button_ctx.last_raw_edge[i];
+            button_accept_edge(i, pressed, edge_cycles, now);
+            next_us = MIN(next_us, BUTTON_DEBOUNCE_US);
+            changed = true;
+        }
+    }
+    if (next_us != UINT32_MAX)
+    {
+        k_timer_start(&g_button_ctx.debounce_timer, K_USEC(next_us), K_NO_WAIT);
+    }
+    uint16_t pressed_mask = g_button_ctx.debounced_mask;
+    k_spin_unlock(&g_button_ctx.lock, key);
+
+    if (changed)
+    {
+        button_notify_change(pressed_mask, edge_cycles);
+    }
+}
+
 /**
  * @brief Initialize the button driver with GPIO specifications
  */
@@ -51,6 +237,7 @@ button_status_t button_driver_init(
 
     // Clear context
     memset(&g_button_ctx, 0, sizeof(g_button_ctx));
+    k_timer_init(&g_button_ctx.debounce_timer, button_debounce_timer_handler, NULL);
 
     // Store GPIO specifications
     const struct gpio_dt_spec *gpio_specs[BUTTON_COUNT] = {
@@ -90,22 +277,62 @@ button_status_t button_driver_init(
         }
 
         // Initialize button state
-        g_button_ctx.button_states[i].current_state = false;
-        g_button_ctx.button_states[i].previous_state = false;
         g_button_ctx.button_states[i].press_time = 0;
         g_button_ctx.button_states[i].release_time = 0;
-        g_button_ctx.button_states[i].is_pressed = false;
-        g_button_ctx.button_states[i].just_pressed = false;
-        g_button_ctx.button_states[i].just_released = false;
+
+        // Group pins per port - one edge callback and one snapshot read serve every button on that port
+        int port = 0;
+        while (port < g_button_ctx.port_count && g_button_ctx.port_dev[port] != gpio_specs[i]->port)
+        {
+            port++;
+        }
+        if (port == g_button_ctx.port_count)
+        {
+            if (port == BUTTON_MAX_PORTS)
+            {
+                LOG_ERR("Button %d (%s) is on an unexpected GPIO port", i, button_names[i]);
+                return BUTTON_STATUS_ERROR;
+            }
+            g_button_ctx.port_dev[port] = gpio_specs[i]->port;
+            g_button_ctx.port_count++;
+        }
+        g_button_ctx.port_pins[port] |= BIT(gpio_specs[i]->pin);
+        g_button_ctx.button_port[i] = port;
+        g_button_ctx.button_pin[i] = gpio_specs[i]->pin;
+        if (g_button_ctx.button_configs[i].active_low)
+        {
+            g_button_ctx.port_invert[port] |= BIT(gpio_specs[i]->pin);
+        }
 
         LOG_INF("Button %d (%s) configured successfully", i, button_names[i]);
     }
 
+    // Start from the current levels so buttons held at boot aren't reported as edges
+    uint32_t now_cycles = k_cycle_get_32();
+    for (int i = 0; i < BUTTON_COUNT; i++)
+    {
+        g_button_ctx.button_states[i].edge_cycles = now_cycles;
+    }
+    g_button_ctx.debounced_mask = button_driver_read_snapshot();
+
+    for (int port = 0; port < g_button_ctx.port_count; port++)
+    {
+        gpio_init_callback(&g_button_ctx.port_cb[port], button_gpio_callback, g_button_ctx.port_pins[port]);
+        int ret = gpio_add_callback(g_button_ctx.port_dev[port], &g_button_ctx.port_cb[port]);
+        if (ret != 0)
+        {
+            LOG_ERR("Failed to add button callback on port %d: %d", port, ret);
+            return BUTTON_STATUS_ERROR;
+        }
+    }
+
     // Enable haptic feedback by default
     g_button_ctx.haptic_feedback_enabled = true;
     g_button_ctx.initialized = true;
     g_button_ctx.scan_count = 0;
 
+    button_driver_set_interrupts(true);
+
     LOG_INF("Button driver initialized with %d buttons", BUTTON_COUNT);
     return BUTTON_STATUS_OK;
 }
@@ -121,50 +348,58 @@ button_status_t button_driver_scan(void)
     }
 
     uint32_t current_time = k_uptime_get_32();
-    bool any_button_just_pressed = false;
+    uint32_t now_cycles = k_cycle_get_32();
+    bool changed = false;
 
-    // Scan each button
-    for (int i = 0; i < BUTTON_COUNT; i++)
+    // Edges are debounced in interrupt context - a scan only samples pins without one
+    // and consumes the debounced state
+    k_spinlock_key_t key = k_spin_lock(&g_button_ctx.lock);
+    if (g_button_ctx.poll_mask)
     {
-        button_state_t *state = &g_button_ctx.button_states[i];
-        const button_config_t *config = &g_button_ctx.button_configs[i];
-
-        // Store previous state
-        state->previous_state = state->current_state;
-
-        // Read current GPIO state
-        int gpio_value = gpio_pin_get_dt(config->gpio_spec);
-        if (gpio_value < 0)
+        uint16_t snapshot = button_driver_read_snapshot();
+        for (int i = 0; i < BUTTON_COUNT; i++)
         {
-            LOG_WRN("Failed to read button %d (%s): %d", i, button_names[i], gpio_value);
-            continue;
+            if (g_button_ctx.poll_mask & BIT(i))
+            {
+                changed |= button_debounce_edge(i, now_cycles, snapshot);
+            }
         }
+    }
+    uint16_t debounced = g_button_ctx.debounced_mask;
+    uint16_t pressed_since_scan = g_button_ctx.press_latch;
+    g_button_ctx.press_latch = 0;
+    k_spin_unlock(&g_button_ctx.lock, key);
 
-        // Convert GPIO value to button state (considering active_low)
-        if (config->active_low)
-        {
-            state->current_state = !(gpio_value == 0); // Active low: 0 = pressed
-        }
-        else
-        {
-            state->current_state = !(gpio_value == 1); // Active high: 1 = pressed
-        }
+    if (changed)
+    {
+        button_notify_change(debounced, now_cycles);
+    }
 
-        // Update edge detection flags
-        state->just_pressed = (!state->previous_state && state->current_state);
-        state->just_released = (state->previous_state && !state->current_state);
-        state->is_pressed = state->current_state;
+    // All buttons at once: a tap shorter than the scan period still reads as pressed once
+    uint16_t previous = g_button_ctx.pressed_mask;
+    uint16_t current = debounced | pressed_since_scan;
+    g_button_ctx.pressed_mask = current;
+    g_button_ctx.just_pressed_mask = pressed_since_scan | (current & ~previous);
+    g_button_ctx.just_released_mask = previous & ~current;
+    bool any_button_just_pressed = g_button_ctx.just_pressed_mask != 0;
+
+    // Edge times come from the interrupt timestamps, only buttons that changed are visited
+    uint16_t edges = g_button_ctx.just_pressed_mask | g_button_ctx.just_released_mask;
+    while (edges)
+    {
+        int i = __builtin_ctz(edges);
+        button_state_t *state = &g_button_ctx.button_states[i];
+        uint32_t edge_time = current_time - k_cyc_to_ms_floor32(now_cycles - state->edge_cycles);
 
-        // Update timing
-        if (state->just_pressed)
+        if (g_button_ctx.just_pressed_mask & BIT(i))
         {
-            state->press_time = current_time;
-            any_button_just_pressed = true;
+            state->press_time = edge_time;
         }
-        else if (state->just_released)
+        else
         {
-            state->release_time = current_time;
+            state->release_time = edge_time;
         }
+        edges &= edges - 1;
     }
 
     // Provide haptic feedback for button presses
@@ -180,6 +415,68 @@ button_status_t button_driver_scan(void)
     return BUTTON_STATUS_OK;
 }
 
+/**
+ * @brief Register a callback for debounced state changes
+ */
+button_status_t button_driver_register_change_callback(button_change_callback_t callback)
+{
+    if (!g_button_ctx.initialized)
+    {
+        return BUTTON_STATUS_NOT_INITIALIZED;
+    }
+
+    g_button_ctx.change_cb = callback;
+    return BUTTON_STATUS_OK;
+}
+
+/**
+ * @brief Enable or disable the button edge interrupts
+ */
+button_status_t button_driver_set_interrupts(bool enable)
+{
+    if (!g_button_ctx.initialized)
+    {
+        return BUTTON_STATUS_NOT_INITIALIZED;
+    }
+
+    uint16_t poll_mask = 0;
+    for (int i = 0; i < BUTTON_COUNT; i++)
+    {
+        const struct gpio_dt_spec *spec = g_button_ctx.button_configs[i].gpio_spec;
+        int ret = gpio_pin_interrupt_configure_dt(spec, enable ? GPIO_INT_EDGE_BOTH : GPIO_INT_DISABLE);
+        if (ret != 0 && enable)
+        {
+            // Out of GPIOTE channels (no sense-edge-mask for this pin) - fall back to scanning it
+            LOG_WRN("Button %d (%s) has no edge interrupt (%d), polling it", i, button_names[i], ret);
+            poll_mask |= BIT(i);
+        }
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&g_button_ctx.lock);
+    g_button_ctx.poll_mask = enable ? poll_mask : 0;
+    if (!enable)
+    {
+        k_timer_stop(&g_button_ctx.debounce_timer);
+        g_button_ctx.lockout_mask = 0;
+    }
+    k_spin_unlock(&g_button_ctx.lock, key);
+
+    return BUTTON_STATUS_OK;
+}
+
+/**
+ * @brief Get the timestamp of a button's last accepted edge
+ */
+uint32_t button_driver_get_edge_cycles(button_id_t button_id)
+{
+    if (!g_button_ctx.initialized || button_id >= BUTTON_COUNT)
+    {
+        return 0;
+    }
+
+    return g_button_ctx.button_states[button_id].edge_cycles;
+}
+
 /**
  * @brief Get current button data in controller format
  */
@@ -195,58 +492,25 @@ button_status_t button_driver_get_data(button_data_t *data)
         return BUTTON_STATUS_ERROR;
     }
 
-    // Clear data structure
-    data->buttons = 0;
-    data->flags = 0;
-
     // Map button states to controller data format
     // Buttons format: Start/Select(0x80), Trackpad Click(0x40), Stick Click(0x20), Bumper(0x10), A/Down(0x08), B/Right(0x04), X/Left(0x02), Y/Up(0x01)
-    if (g_button_ctx.button_states[BUTTON_START].is_pressed) {
-        data->buttons |= 0x80; // Bit 7: Start/Select
-    }
-    if (g_button_ctx.button_states[BUTTON_PAD_CLICK].is_pressed) {
-        data->buttons |= 0x40; // Bit 6: Trackpad Click
-    }
-    if (g_button_ctx.button_states[BUTTON_STICK_CLICK].is_pressed) {
-        data->buttons |= 0x20; // Bit 5: Stick click
-    }
-    if (g_button_ctx.button_states[BUTTON_BUMPER].is_pressed) {
-        data->buttons |= 0x10; // Bit 4: Bumper (L1)
-    }
-    if (g_button_ctx.button_states[BUTTON_DPAD_DOWN].is_pressed) {
-        data->buttons |= 0x08; // Bit 3: A/Down
-    }
-    if (g_button_ctx.button_states[BUTTON_DPAD_RIGHT].is_pressed) {
-        data->buttons |= 0x04; // Bit 2: B/Right
-    }
-    if (g_button_ctx.button_states[BUTTON_DPAD_LEFT].is_pressed) {
-        data->buttons |= 0x02; // Bit 1: X/Left
-    }
-    if (g_button_ctx.button_states[BUTTON_DPAD_UP].is_pressed) {
-        data->buttons |= 0x01; // Bit 0: Y/Up
+    // Flags format: ID(0x80), Mode1(0x40), Mode2(0x20), TBD(0x10), TBD(0x08), TrackpadTap(0x04), P4(0x02), P5(0x01)
+    // Each pressed bit selects its word bit through an all-ones mask - no branch per button
+    uint16_t pressed = g_button_ctx.pressed_mask;
+    uint16_t word = 0;
+    for (int i = 0; i < BUTTON_COUNT; i++)
+    {
+        word |= button_word_bits[i] & (uint16_t)-(int16_t)((pressed >> i) & 1U);
     }
+    data->buttons = (uint8_t)word;
+    data->flags = (uint8_t)(word >> 8);
 
-    // Flags format: ID(0x80), Mode1(0x40), Mode2(0x20), TBD(0x10), TBD(0x08), TrackpadTap(0x04), P4(0x02), P5(0x01)
-    // Note: You might want to set ID bit if this is a specific controller
-    // data->flags |= 0x80; // ID bit - uncomment if needed
-    
-    if (g_button_ctx.button_states[BUTTON_MODE].is_pressed) {
-        data->flags |= 0x40; // Bit 6: Mode1 button
-    }
-    // If you have a second mode button, map it to:
-    // data->flags |= 0x20; // Bit 5: Mode2 button
-    
-    // Bit 4 and 3 are marked as TBD (To Be Determined)
-    
-    // Note: TrackpadTap might be different from TrackpadClick - you may need to distinguish these
-    // For now, I'll leave this bit available for a different trackpad gesture
-    // data->flags |= 0x04; // Bit 2: TrackpadTap (different from click?)
-    
-    if (g_button_ctx.button_states[BUTTON_P4].is_pressed) {
-        data->flags |= 0x02; // Bit 1: P4 button
-    }
-    if (g_button_ctx.button_states[BUTTON_P5].is_pressed) {
-        data->flags |= 0x01; // Bit 0: P5 button
+    // Apply user bindings - two table lookups regardless of how many buttons are held
+    if (g_button_ctx.remap_enabled)
+    {
+        word = g_remap_buttons_lut[data->buttons] | g_remap_flags_lut[data->flags & 0x7F];
+        data->buttons = (uint8_t)word;
+        data->flags = (uint8_t)(word >> 8);
     }
 
     // LOG_INF("Buttons: %c%c%c%c%c%c%c%c (0x%02X) Flags: %c%c%c%c%c%c%c%c (0x%02X)",
@@ -285,7 +549,7 @@ bool button_driver_is_pressed(button_id_t button_id)
         return false;
     }
 
-    return g_button_ctx.button_states[button_id].is_pressed;
+    return (g_button_ctx.pressed_mask & BIT(button_id)) != 0;
 }
 
 /**
@@ -298,7 +562,7 @@ bool button_driver_just_pressed(button_id_t button_id)
         return false;
     }
 
-    return g_button_ctx.button_states[button_id].just_pressed;
+    return (g_button_ctx.just_pressed_mask & BIT(button_id)) != 0;
 }
 
 /**
@@ -311,7 +575,7 @@ bool button_driver_just_released(button_id_t button_id)
         return false;
     }
 
-    return g_button_ctx.button_states[button_id].just_released;
+    return (g_button_ctx.just_released_mask & BIT(button_id)) != 0;
 }
 
 /**
@@ -324,14 +588,12 @@ uint32_t button_driver_get_press_duration(button_id_t button_id)
         return 0;
     }
 
-    const button_state_t *state = &g_button_ctx.button_states[button_id];
-
-    if (!state->is_pressed)
+    if (!(g_button_ctx.pressed_mask & BIT(button_id)))
     {
         return 0; // Button not currently pressed
     }
 
-    return k_uptime_get_32() - state->press_time;
+    return k_uptime_get_32() - g_button_ctx.button_states[button_id].press_time;
 }
 
 /**
@@ -367,17 +629,62 @@ button_status_t button_driver_get_stats(uint32_t *total_scans, uint8_t *active_b
 
     if (active_buttons)
     {
-        uint8_t count = 0;
-        for (int i = 0; i < BUTTON_COUNT; i++)
+        *active_buttons = (uint8_t)__builtin_popcount(g_button_ctx.pressed_mask);
+    }
+
+    return BUTTON_STATUS_OK;
+}
+
+/**
+ * @brief Apply a button binding map
+ */
+button_status_t button_driver_set_map(const uint8_t map[BUTTON_REMAP_INPUTS])
+{
+    if (!map)
+    {
+        return BUTTON_STATUS_ERROR;
+    }
+
+    uint16_t target[BUTTON_REMAP_INPUTS];
+    bool identity = true;
+
+    for (int i = 0; i < BUTTON_REMAP_INPUTS; i++)
+    {
+        // The controller ID bit is never a button source or target
+        bool bound = (i != 15) && (map[i] < 15);
+        target[i] = bound ? (uint16_t)(1U << map[i]) : 0;
+        if (target[i] != (uint16_t)((i != 15) ? (1U << i) : 0))
+        {
+            identity = false;
+        }
+    }
+
+    g_button_ctx.remap_enabled = false;
+
+    for (int value = 0; value < 256; value++)
+    {
+        uint16_t buttons_word = 0;
+        uint16_t flags_word = 0;
+
+        for (int bit = 0; bit < 8; bit++)
         {
-            if (g_button_ctx.button_states[i].is_pressed)
+            if (value & (1 << bit))
             {
-                count++;
+                buttons_word |= target[bit];
+                flags_word |= target[8 + bit];
             }
         }
-        *active_buttons = count;
+
+        g_remap_buttons_lut[value] = buttons_word;
+        if (value < 128)
+        {
+            g_remap_flags_lut[value] = flags_word;
+        }
     }
 
+    g_button_ctx.remap_enabled = !identity;
+    LOG_INF("Button map applied (%s)", identity ? "identity" : "remapped");
+
     return BUTTON_STATUS_OK;
 }
 
@@ -402,18 +709,23 @@ button_status_t button_driver_reset(void)
     // Reset all button states
     for (int i = 0; i < BUTTON_COUNT; i++)
     {
-        button_state_t *state = &g_button_ctx.button_states[i];
-        state->current_state = false;
-        state->previous_state = false;
-        state->press_time = 0;
-        state->release_time = 0;
-        state->is_pressed = false;
-        state->just_pressed = false;
-        state->just_released = false;
+        g_button_ctx.button_states[i].press_time = 0;
+        g_button_ctx.button_states[i].release_time = 0;
     }
+    g_button_ctx.pressed_mask = 0;
+    g_button_ctx.just_pressed_mask = 0;
+    g_button_ctx.just_released_mask = 0;
+
+    // Re-sync the debounced levels with the pins
+    k_spinlock_key_t key = k_spin_lock(&g_button_ctx.lock);
+    g_button_ctx.press_latch = 0;
+    g_button_ctx.debounced_mask = button_driver_read_snapshot();
+    k_spin_unlock(&g_button_ctx.lock, key);
 
     // Reset statistics
     g_button_ctx.scan_count = 0;
+    g_button_ctx.edge_count = 0;
+    g_button_ctx.bounce_count = 0;
 
     // Clear current data
     g_button_ctx.current_data.buttons = 0;
@@ -22,6 +22,11 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+// Edge interrupts: the first edge from a stable level is reported at once, later edges
+// inside the lockout are bounce and the level is re-checked when the lockout ends
+#define BUTTON_DEBOUNCE_US      5000    // Lockout after an accepted edge
+#define BUTTON_MAX_PORTS        2       // gpio0 + gpio1
+
 // Button status enumeration
 typedef enum {
     BUTTON_STATUS_OK = 0,
@@ -46,17 +51,20 @@ typedef enum {
     BUTTON_COUNT  // Total number of buttons
 } button_id_t;
 
-// Button state structure
+// Button timing - pressed/just pressed/just released live as bitmasks in the context
 typedef struct {
-    bool current_state;     // Current button state (true = pressed)
-    bool previous_state;    // Previous button state for edge detection
     uint32_t press_time;    // Time when button was first pressed
     uint32_t release_time;  // Time when button was released
-    bool is_pressed;        // True if button is currently pressed
-    bool just_pressed;      // True if button was just pressed this cycle
-    bool just_released;     // True if button was just released this cycle
+    uint32_t edge_cycles;   // k_cycle_get_32() at the last accepted edge
 } button_state_t;
 
+/**
+ * @brief Called from interrupt context whenever the debounced button state changes
+ * @param pressed_mask Debounced state, bit n = button_id_t n pressed
+ * @param edge_cycles k_cycle_get_32() timestamp of the edge
+ */
+typedef void (*button_change_callback_t)(uint16_t pressed_mask, uint32_t edge_cycles);
+
 // Button configuration structure
 typedef struct {
     const struct gpio_dt_spec *gpio_spec;  // GPIO specification
@@ -64,6 +72,10 @@ typedef struct {
     bool pull_up;                         // True if internal pull-up should be enabled
 } button_config_t;
 
+// Physical inputs covered by the binding map: bits 0-7 = buttons, bits 8-14 = flags (bit 15 is the controller ID)
+#define BUTTON_REMAP_INPUTS 16
+#define BUTTON_REMAP_UNBOUND 0xFF
+
 // Controller button data structure (matches main.c format)
 typedef struct {
     uint8_t buttons;    // Main button byte (bits 0-7)
@@ -76,8 +88,39 @@ typedef struct {
     button_state_t button_states[BUTTON_COUNT];
     button_config_t button_configs[BUTTON_COUNT];
     button_data_t current_data;
+    bool remap_enabled;     // False while the binding map is the identity
     uint32_t scan_count;
     bool haptic_feedback_enabled;
+
+    // Edge interrupts, one callback per GPIO port
+    struct gpio_callback port_cb[BUTTON_MAX_PORTS];
+    const struct device *port_dev[BUTTON_MAX_PORTS];
+    uint32_t port_pins[BUTTON_MAX_PORTS];
+    uint8_t port_count;
+    uint16_t poll_mask;             // Buttons without an edge interrupt - sampled by scans instead
+
+    // Port snapshot decode, built from the gpio_dt_specs at init: one input register read
+    // per port, XOR so 1 = pressed, then each button's bit shifted into place
+    uint32_t port_invert[BUTTON_MAX_PORTS];
+    uint8_t button_port[BUTTON_COUNT];
+    uint8_t button_pin[BUTTON_COUNT];
+
+    // Scan results, bit n = button_id_t n
+    uint16_t pressed_mask;
+    uint16_t just_pressed_mask;
+    uint16_t just_released_mask;
+
+    // Debounce state shared with interrupt context (guarded by lock)
+    struct k_spinlock lock;
+    struct k_timer debounce_timer;
+    uint16_t debounced_mask;        // Debounced level, bit per button
+    uint16_t press_latch;           // Presses since the last scan - a tap between scans still shows once
+    uint16_t lockout_mask;          // Buttons inside their debounce lockout
+    uint32_t lockout_start[BUTTON_COUNT];
+    uint32_t last_raw_edge[BUTTON_COUNT];
+    uint32_t edge_count;            // Accepted edges
+    uint32_t bounce_count;          // Edges rejected as bounce
+    button_change_callback_t change_cb;
 } button_driver_context_t;
 
 // Function prototypes
@@ -117,6 +160,40 @@ button_status_t button_driver_init(
  */
 button_status_t button_driver_scan(void);
 
+/**
+ * @brief Read every button in one input register read per port (no debounce)
+ *
+ * Safe from interrupt context and cheap enough for kHz-rate sampling.
+ *
+ * @return uint16_t Raw pressed state, bit n = button_id_t n
+ */
+uint16_t button_driver_read_snapshot(void);
+
+/**
+ * @brief Register a callback for debounced state changes (interrupt context)
+ * @param callback Function to call, NULL to remove
+ * @return button_status_t Status of operation
+ */
+button_status_t button_driver_register_change_callback(button_change_callback_t callback);
+
+/**
+ * @brief Enable or disable the button edge interrupts
+ *
+ * Other drivers that reconfigure a button pin (e.g. power management's wake
+ * button) leave its interrupt disabled - re-enable afterwards.
+ *
+ * @param enable True to arm edge interrupts, false to disable them
+ * @return button_status_t Status of operation
+ */
+button_status_t button_driver_set_interrupts(bool enable);
+
+/**
+ * @brief Get the timestamp of a button's last accepted edge
+ * @param button_id ID of button to check
+ * @return uint32_t k_cycle_get_32() value of the edge, 0 if never changed
+ */
+uint32_t button_driver_get_edge_cycles(button_id_t button_id);
+
 /**
  * @brief Get current button data in controller format
  * @param data Pointer to button_data_t structure to fill
@@ -179,6 +256,13 @@ bool button_driver_is_initialized(void);
  */
 button_status_t button_driver_reset(void);
 
+/**
+ * @brief Apply a button binding map (controller_bindings_t.button_map layout)
+ * @param map Logical input for each physical input; BUTTON_REMAP_UNBOUND disables an input
+ * @return button_status_t Status of operation
+ */
+button_status_t button_driver_set_map(const uint8_t map[BUTTON_REMAP_INPUTS]);
+
 /**
  * @brief Get human-readable name for a button ID
  * @param button_id ID of button
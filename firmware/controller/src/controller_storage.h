@@ -38,7 +38,7 @@ typedef struct {
     int16_t trigger_min;
     int16_t trigger_max;
     
-    // IMU calibration offsets
+    // IMU calibration offsets (gyro: online bias estimate in mdps, sensor frame)
     int16_t accel_offset_x;
     int16_t accel_offset_y;
     int16_t accel_offset_z;
@@ -5,6 +5,7 @@
 
 #include "display.h"
 #include "ui_Images.h"
+#include "i2c_bus_driver.h"
 
 LOG_MODULE_REGISTER(display_lib, LOG_LEVEL_ERR);
 
@@ -24,7 +25,10 @@ int display_library_init(uint8_t ctrl_id)
         return -ENODEV;
     }
 
-    display_blanking_off(display_dev);
+    if (i2c_bus_acquire(I2C_BUS_CLIENT_DISPLAY, K_MSEC(I2C_BUS_ACQUIRE_TIMEOUT_MS)) == 0) {
+        display_blanking_off(display_dev);
+        i2c_bus_release(I2C_BUS_CLIENT_DISPLAY);
+    }
     return 0;
 }
 
@@ -42,12 +46,36 @@ display_status_t display_get_status(void)
 // Display buffer for drawing
 static uint8_t display_buffer[DISPLAY_BUFFER_SIZE];
 
+// What the panel currently shows, and which write chunks drawing has touched since the last refresh
+static uint8_t display_shadow[DISPLAY_BUFFER_SIZE];
+static bool display_shadow_valid = false;
+static uint32_t display_dirty_chunks = 0;
+
+BUILD_ASSERT(DISPLAY_WIDTH % DISPLAY_WRITE_CHUNK_WIDTH == 0, "Chunk width must divide the display width");
+BUILD_ASSERT(DISPLAY_CHUNK_COUNT <= 32, "Dirty mask holds one bit per chunk");
+
+/**
+ * @brief Flag the write chunk holding buffer byte index as dirty
+ */
+static inline void display_mark_dirty(uint16_t index)
+{
+    uint16_t page = index / DISPLAY_WIDTH;
+    uint16_t column = index % DISPLAY_WIDTH;
+
+    display_dirty_chunks |= BIT(page * DISPLAY_CHUNKS_PER_PAGE + column / DISPLAY_WRITE_CHUNK_WIDTH);
+}
+
 /**
  * @brief Clear the display buffer
  */
 void display_clear(void)
 {
-    memset(display_buffer, 0, DISPLAY_BUFFER_SIZE);
+    for (uint16_t i = 0; i < DISPLAY_BUFFER_SIZE; i++) {
+        if (display_buffer[i]) {
+            display_buffer[i] = 0;
+            display_mark_dirty(i);
+        }
+    }
 }
 
 /**
@@ -56,10 +84,18 @@ void display_clear(void)
 void display_set_pixel(int16_t x, int16_t y, bool on)
 {
     if (x >= 0 && x < DISPLAY_WIDTH && y >= 0 && y < DISPLAY_HEIGHT) {
+        uint16_t index = x + (y / 8) * DISPLAY_WIDTH;
+        uint8_t value = display_buffer[index];
+
         if (on) {
-            display_buffer[x + (y / 8) * DISPLAY_WIDTH] |= (1 << (y & 7));
+            value |= (1 << (y & 7));
         } else {
-            display_buffer[x + (y / 8) * DISPLAY_WIDTH] &= ~(1 << (y & 7));
+            value &= ~(1 << (y & 7));
+        }
+
+        if (value != display_buffer[index]) {
+            display_buffer[index] = value;
+            display_mark_dirty(index);
         }
     }
 }
@@ -160,22 +196,74 @@ void display_draw_controller_id(uint8_t ctrl_id)
 }
 
 /**
- * @brief Write display buffer to screen (call only when content changes)
+ * @brief Write the changed parts of the display buffer to the screen
+ *
+ * The frame goes out in DISPLAY_WRITE_CHUNK_WIDTH x 8 pixel chunks, each its own
+ * i2c1 transaction, so trackpad and haptic requests get the bus between chunks.
+ * Screens are redrawn from scratch every frame, so a dirty chunk is still compared
+ * with the panel contents and skipped when the redraw produced the same pixels.
  */
 void display_refresh_screen(void)
 {
     if (!display_dev || !device_is_ready(display_dev)) {
         return;
     }
+
+    if (display_shadow_valid && display_dirty_chunks == 0) {
+        return;
+    }
     
+    // One chunk is contiguous in the buffer: a run of columns within one 8-pixel page
     struct display_buffer_descriptor desc = {
-        .buf_size = DISPLAY_BUFFER_SIZE,
-        .width = DISPLAY_WIDTH,
-        .height = DISPLAY_HEIGHT,
-        .pitch = DISPLAY_WIDTH
+        .buf_size = DISPLAY_WRITE_CHUNK_WIDTH,
+        .width = DISPLAY_WRITE_CHUNK_WIDTH,
+        .height = 8,
+        .pitch = DISPLAY_WRITE_CHUNK_WIDTH
     };
     
-    display_write(display_dev, 0, 0, &desc, display_buffer);
+    bool all_written = true;
+    for (uint16_t chunk = 0; chunk < DISPLAY_CHUNK_COUNT; chunk++) {
+        uint16_t page = chunk / DISPLAY_CHUNKS_PER_PAGE;
+        uint16_t x = (chunk % DISPLAY_CHUNKS_PER_PAGE) * DISPLAY_WRITE_CHUNK_WIDTH;
+        uint16_t offset = page * DISPLAY_WIDTH + x;
+
+        if (display_shadow_valid) {
+            if (!(display_dirty_chunks & BIT(chunk))) {
+                continue;
+            }
+            if (memcmp(&display_buffer[offset], &display_shadow[offset], DISPLAY_WRITE_CHUNK_WIDTH) == 0) {
+                display_dirty_chunks &= ~BIT(chunk);
+                continue;
+            }
+        }
+
+        if (i2c_bus_acquire(I2C_BUS_CLIENT_DISPLAY, K_MSEC(I2C_BUS_ACQUIRE_TIMEOUT_MS)) != 0) {
+            return;
+        }
+        int ret = display_write(display_dev, x, page * 8, &desc, &display_buffer[offset]);
+        i2c_bus_release(I2C_BUS_CLIENT_DISPLAY);
+
+        // A failed chunk stays dirty and is retried on the next refresh
+        if (ret == 0) {
+            memcpy(&display_shadow[offset], &display_buffer[offset], DISPLAY_WRITE_CHUNK_WIDTH);
+            display_dirty_chunks &= ~BIT(chunk);
+        } else {
+            display_dirty_chunks |= BIT(chunk);
+            all_written = false;
+        }
+    }
+
+    if (!display_shadow_valid && all_written) {
+        display_shadow_valid = true;
+    }
+}
+
+/**
+ * @brief Forget what the panel shows so the next refresh writes every chunk
+ */
+void display_invalidate(void)
+{
+    display_shadow_valid = false;
 }
 
 /**
@@ -205,11 +293,19 @@ int display_set_blanking(bool blank)
         return -ENODEV;
     }
     
+    int ret = i2c_bus_acquire(I2C_BUS_CLIENT_DISPLAY, K_MSEC(I2C_BUS_ACQUIRE_TIMEOUT_MS));
+    if (ret != 0) {
+        return ret;
+    }
+
     if (blank) {
-        return display_blanking_on(display_dev);
+        ret = display_blanking_on(display_dev);
     } else {
-        return display_blanking_off(display_dev);
+        ret = display_blanking_off(display_dev);
     }
+
+    i2c_bus_release(I2C_BUS_CLIENT_DISPLAY);
+    return ret;
 }
 
 void display_draw_hline(int16_t x, int16_t y, int16_t width)
@@ -23,6 +23,15 @@
 #define DISPLAY_HEIGHT 32
 #define DISPLAY_BUFFER_SIZE (DISPLAY_WIDTH * (DISPLAY_HEIGHT / 8))
 
+/**
+ * @brief Columns per i2c1 write when refreshing (16 bytes, ~0.5 ms at 400 kHz)
+ *
+ * Bounds how long a trackpad read can wait behind the display. Must divide DISPLAY_WIDTH.
+ */
+#define DISPLAY_WRITE_CHUNK_WIDTH 16
+#define DISPLAY_CHUNKS_PER_PAGE   (DISPLAY_WIDTH / DISPLAY_WRITE_CHUNK_WIDTH)
+#define DISPLAY_CHUNK_COUNT       (DISPLAY_CHUNKS_PER_PAGE * (DISPLAY_HEIGHT / 8))
+
 /**
  * @brief Display status enumeration
  */
@@ -104,10 +113,18 @@ void display_draw_status_indicators(bool show_blink);
 int display_refresh(void);
 
 /**
- * @brief Write display buffer to screen (call only when content changes)
+ * @brief Write the changed parts of the display buffer to the screen
+ *
+ * Only chunks touched by drawing since the last refresh and different from
+ * what the panel shows are written - an unchanged frame costs no bus time.
  */
 void display_refresh_screen(void);
 
+/**
+ * @brief Forget what the panel shows so the next refresh writes every chunk
+ */
+void display_invalidate(void);
+
 /**
  * @brief Main display update function - call this regularly
  * 
@@ -11,6 +11,7 @@
 #include <string.h>
 
 #include "drv2605.h"
+#include "i2c_bus_driver.h"
 
 LOG_MODULE_REGISTER(drv2605, LOG_LEVEL_ERR);
 
@@ -618,7 +619,7 @@ static int drv2605_write_reg(const drv2605_device_t *dev, uint8_t reg, uint8_t v
 {
     uint8_t buf[2] = {reg, value};
     
-    int ret = i2c_write(dev->config->i2c_dev, buf, sizeof(buf), dev->config->i2c_addr);
+    int ret = i2c_bus_write(I2C_BUS_CLIENT_HAPTICS, buf, sizeof(buf), dev->config->i2c_addr);
     if (ret != 0) {
         LOG_ERR("I2C write failed: reg=0x%02X, value=0x%02X, error=%d", reg, value, ret);
     }
@@ -628,8 +629,8 @@ static int drv2605_write_reg(const drv2605_device_t *dev, uint8_t reg, uint8_t v
 
 static int drv2605_read_reg(const drv2605_device_t *dev, uint8_t reg, uint8_t *value)
 {
-    int ret = i2c_write_read(dev->config->i2c_dev, dev->config->i2c_addr,
-                            &reg, 1, value, 1);
+    int ret = i2c_bus_write_read(I2C_BUS_CLIENT_HAPTICS, dev->config->i2c_addr,
+                                 &reg, 1, value, 1);
     if (ret != 0) {
         LOG_ERR("I2C read failed: reg=0x%02X, error=%d", reg, ret);
     }
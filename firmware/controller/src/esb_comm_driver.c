@@ -11,8 +11,12 @@
 #include <zephyr/drivers/clock_control.h>
 #include <zephyr/drivers/clock_control/nrf_clock_control.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/byteorder.h>
 #include <string.h>
+#include <stdlib.h>
 #include <esb.h>
+#include <nrfx_timer.h>
 #include "esb_comm_driver.h"
 
 #define PLAYER_ID 2     // Change to 1 for PLAYER 1, 2 for PLAYER 2 (different address set)
@@ -34,16 +38,78 @@ typedef struct
     bool ack_timing_active;
     ack_timing_data_t last_ack_data; // Last received ACK payload data
     uint32_t next_tx_delay_ms;
-    uint8_t current_rumble_left;  // 0-15 left motor intensity
-    uint8_t current_rumble_right; // 0-15 right motor intensity
+    uint8_t current_rumble;       // Host motor amplitude for this half (0-255)
+    esb_comm_rumble_callback_t rumble_cb; // Fed from every ACK payload
+    esb_comm_slot_callback_t slot_cb;     // Slot tick to the application
+    // TDMA slot timer - packets are launched from the timer ISR at the start of our slot
+    bool slot_timer_ready;        // nrfx timer instance initialized
+    bool slot_timer_running;      // Slot compare armed and transmitting
+    uint32_t slot_period_us;      // Current superframe period (from dongle ACK)
+    uint32_t slot_next_us;        // Absolute local time of the next slot start
+    atomic_t slot_correction_us;  // Pending phase correction, consumed by the next slot
+    esb_controller_data_t slot_data[2]; // Double buffer published by the radio stage
+    uint32_t slot_data_us[2];     // Local time each buffer was published (sample age)
+    uint32_t slot_data_seq[2];    // Publish sequence of each buffer
+    atomic_t slot_data_idx;       // Index of the buffer the ISR transmits from
+    bool slot_data_valid;         // At least one packet has been published
+    uint32_t slot_publish_seq;    // Bumped per publish
+    uint32_t slot_launch_seq;     // Sequence of the last launched buffer - launching it again is a stale resend
+    uint32_t sample_lead_us;      // Slot callback fires this long before slot_next_us
+    // Clock sync - local TX time of the packet in flight and the previous acknowledged one
+    uint32_t tx_local_us;         // Local time the in-flight packet was handed to the radio
+    uint8_t tx_length;            // Payload length of the in-flight packet
+    uint32_t prev_tx_local_us;    // Local RX-equivalent time of the previous acknowledged packet
+    bool prev_tx_valid;           // Previous packet was acknowledged (its timestamp is in this ACK)
+    // Delta encoding - changes are sent relative to the last state the dongle acknowledged
+    esb_controller_data_t tx_inflight;  // State carried by the packet in the air
+    esb_controller_data_t tx_baseline;  // Last acknowledged state
+    bool tx_baseline_valid;       // Baseline exists (otherwise send a keyframe)
+    uint8_t tx_unacked_mask;      // ESB_WIRE_FIELD_* sent since the last ACK - the dongle may or may not hold them
+    bool tx_unacked_touch;        // Touch block sent since the last ACK
+    uint8_t tx_since_keyframe;    // Packets since the last keyframe
+    // IMU samples waiting for an acknowledged packet (indexed by sequence number)
+    esb_imu_sample_t imu_queue[ESB_IMU_QUEUE_SIZE];
+    uint8_t imu_next_seq;         // Sequence number of the next queued sample
+    uint8_t imu_pending;          // Unacknowledged samples, oldest = imu_next_seq - imu_pending
+    uint8_t imu_inflight_end;     // Sequence after the last sample in the packet in the air
+    bool imu_seq_acked;           // An IMU batch was acknowledged since boot (sequence no longer restarting)
 } esb_comm_context_t;
 
+// Clock sync estimator - least squares fit of dongle time against local time
+// Samples are stored relative to the newest one so the fit stays in 32-bit ranges
+typedef struct
+{
+    uint32_t local_us[ESB_SYNC_WINDOW_SIZE];
+    uint32_t dongle_us[ESB_SYNC_WINDOW_SIZE];
+    uint8_t head;
+    uint8_t count;
+    uint8_t outliers;
+    uint32_t last_sample_local_us;
+    // Fit result: dongle = ref_dongle + d + ((d * slope_q20) >> 20) + intercept, d = local - ref_local
+    uint32_t ref_local_us;
+    uint32_t ref_dongle_us;
+    int32_t slope_q20;
+    int32_t intercept_us;
+} esb_clock_sync_t;
+
 // Global context
 static esb_comm_context_t g_esb_ctx = {0};
+static esb_clock_sync_t g_clock_sync = {0};
+
+// Slot timer: free-running TIMER1 @ 1MHz (ESB itself uses TIMER2)
+// CC0 = next slot start (compare + interrupt), CC1 = capture for esb_comm_local_time_us(), CC2 = capture in slot ISR,
+// CC3 = sample point ahead of the next slot (compare + interrupt)
+static const nrfx_timer_t slot_timer = NRFX_TIMER_INSTANCE(1);
+
+#define SLOT_TIMER_GUARD_US 20 // Minimum lead time when arming the next slot compare
 
 // Forward declarations
 static int esb_comm_clocks_start(void);
 static void esb_comm_event_handler(struct esb_evt const *event);
+static esb_comm_status_t esb_comm_write_packet(const esb_controller_data_t *data);
+static void esb_comm_slot_timer_start(void);
+static void esb_comm_slot_timer_stop(void);
+static void esb_comm_clock_sync_reset(void);
 
 /**
  * @brief Start high frequency clocks required for ESB
@@ -85,6 +151,503 @@ static int esb_comm_clocks_start(void)
     return 0;
 }
 
+/**
+ * @brief Append as many pending IMU samples as fit before end (oldest first)
+ * @return write position after the batch
+ */
+static uint8_t *esb_comm_encode_imu_batch(esb_controller_data_t *data, uint8_t *p, const uint8_t *end)
+{
+    uint8_t first_seq = g_esb_ctx.imu_next_seq - g_esb_ctx.imu_pending;
+    uint8_t *hdr = p;
+    uint8_t count = 0;
+    uint8_t full_flags = 0;
+    const esb_imu_sample_t *prev = NULL;
+
+    p += ESB_WIRE_IMU_HEADER_SIZE;
+    while (count < g_esb_ctx.imu_pending && count < ESB_WIRE_IMU_BATCH_MAX)
+    {
+        const esb_imu_sample_t *s = &g_esb_ctx.imu_queue[(uint8_t)(first_seq + count) % ESB_IMU_QUEUE_SIZE];
+        int16_t v[6] = {s->accelX, s->accelY, s->accelZ, s->gyroX, s->gyroY, s->gyroZ};
+        bool full = (prev == NULL);
+
+        int32_t d[6] = {0};
+        if (prev)
+        {
+            int16_t pv[6] = {prev->accelX, prev->accelY, prev->accelZ, prev->gyroX, prev->gyroY, prev->gyroZ};
+            for (int i = 0; i < 6; i++)
+            {
+                d[i] = v[i] - pv[i];
+                if (d[i] < INT8_MIN || d[i] > INT8_MAX)
+                {
+                    full = true;
+                }
+            }
+        }
+
+        if (p + (full ? 12 : 6) > end)
+        {
+            break;
+        }
+
+        for (int i = 0; i < 6; i++)
+        {
+            if (full)
+            {
+                sys_put_le16(v[i], p);
+                p += 2;
+            }
+            else
+            {
+                *p++ = (uint8_t)(int8_t)d[i];
+            }
+        }
+        if (full && prev)
+        {
+            full_flags |= BIT(count);
+        }
+
+        prev = s;
+        count++;
+    }
+
+    hdr[0] = first_seq;
+    hdr[1] = count;
+    hdr[2] = full_flags;
+    g_esb_ctx.imu_inflight_end = first_seq + count;
+
+    // Dongle ends up with the last batched sample - keep the delta baseline in step with it
+    if (prev)
+    {
+        data->accelX = prev->accelX;
+        data->accelY = prev->accelY;
+        data->accelZ = prev->accelZ;
+        data->gyroX = prev->gyroX;
+        data->gyroY = prev->gyroY;
+        data->gyroZ = prev->gyroZ;
+    }
+
+    return p;
+}
+
+/**
+ * @brief Encode controller state as a keyframe or a delta against the acknowledged baseline
+ * @return encoded payload length
+ */
+static uint8_t esb_comm_encode_packet(esb_controller_data_t *data, uint8_t *out)
+{
+    const esb_controller_data_t *base = &g_esb_ctx.tx_baseline;
+    bool keyframe = !g_esb_ctx.tx_baseline_valid ||
+                    g_esb_ctx.tx_since_keyframe >= ESB_WIRE_KEYFRAME_INTERVAL;
+    uint8_t mask = ESB_WIRE_FIELD_ALL;
+    bool imu_batch = g_esb_ctx.imu_pending > 0;
+    // A packet lost after the dongle saw it still moved its state - resend every field sent since the
+    // last ACK, or a change that returned to the baseline value (a released tap) would never arrive
+    bool touch = keyframe || g_esb_ctx.tx_unacked_touch ||
+                 data->touch != base->touch || data->padStrength != base->padStrength ||
+                 data->pad2X != base->pad2X || data->pad2Y != base->pad2Y ||
+                 data->pad2Strength != base->pad2Strength;
+
+    if (!keyframe)
+    {
+        mask = g_esb_ctx.tx_unacked_mask;
+        if (data->flags != base->flags)
+            mask |= ESB_WIRE_FIELD_FLAGS;
+        if (data->trigger != base->trigger)
+            mask |= ESB_WIRE_FIELD_TRIGGER;
+        if (data->stickX != base->stickX || data->stickY != base->stickY)
+            mask |= ESB_WIRE_FIELD_STICK;
+        if (data->padX != base->padX || data->padY != base->padY)
+            mask |= ESB_WIRE_FIELD_PAD;
+        if (data->buttons != base->buttons)
+            mask |= ESB_WIRE_FIELD_BUTTONS;
+        if (data->accelX != base->accelX || data->accelY != base->accelY || data->accelZ != base->accelZ)
+            mask |= ESB_WIRE_FIELD_ACCEL;
+        if (data->gyroX != base->gyroX || data->gyroY != base->gyroY || data->gyroZ != base->gyroZ)
+            mask |= ESB_WIRE_FIELD_GYRO;
+
+        // The batch's last sample carries the current accel/gyro
+        if (imu_batch)
+            mask &= ~(ESB_WIRE_FIELD_ACCEL | ESB_WIRE_FIELD_GYRO);
+    }
+
+    if (imu_batch)
+    {
+        mask |= ESB_WIRE_FIELD_IMU_BATCH;
+    }
+
+    out[0] = (ESB_WIRE_VERSION << 4) | (keyframe ? ESB_WIRE_KEYFRAME : 0) | (touch ? ESB_WIRE_EXT_TOUCH : 0) |
+             ((imu_batch && !g_esb_ctx.imu_seq_acked) ? ESB_WIRE_IMU_RESTART : 0);
+    out[1] = mask;
+    g_esb_ctx.tx_unacked_mask |= mask & ESB_WIRE_FIELD_ALL;
+    g_esb_ctx.tx_unacked_touch |= touch;
+
+    uint8_t *p = out + ESB_WIRE_HEADER_SIZE;
+    if (mask & ESB_WIRE_FIELD_FLAGS)
+    {
+        *p++ = data->flags;
+    }
+    if (mask & ESB_WIRE_FIELD_TRIGGER)
+    {
+        *p++ = data->trigger;
+    }
+    if (mask & ESB_WIRE_FIELD_STICK)
+    {
+        *p++ = (uint8_t)data->stickX;
+        *p++ = (uint8_t)data->stickY;
+    }
+    if (mask & ESB_WIRE_FIELD_PAD)
+    {
+        sys_put_le16(data->padX, p);
+        sys_put_le16(data->padY, p + 2);
+        p += 4;
+    }
+    if (mask & ESB_WIRE_FIELD_BUTTONS)
+    {
+        *p++ = data->buttons;
+    }
+    if (mask & ESB_WIRE_FIELD_ACCEL)
+    {
+        sys_put_le16(data->accelX, p);
+        sys_put_le16(data->accelY, p + 2);
+        sys_put_le16(data->accelZ, p + 4);
+        p += 6;
+    }
+    if (mask & ESB_WIRE_FIELD_GYRO)
+    {
+        sys_put_le16(data->gyroX, p);
+        sys_put_le16(data->gyroY, p + 2);
+        sys_put_le16(data->gyroZ, p + 4);
+        p += 6;
+    }
+    if (touch)
+    {
+        *p++ = data->touch;
+        *p++ = data->padStrength;
+        if (ESB_WIRE_TOUCH_SIZE(data->touch) > 2)
+        {
+            // Coordinates are packed as 12 bits each (the pad uses 0-1023) - two fit in three bytes
+            uint16_t x = (uint16_t)data->pad2X & 0x0FFF;
+            uint16_t y = (uint16_t)data->pad2Y & 0x0FFF;
+            *p++ = x & 0xFF;
+            *p++ = (x >> 8) | ((y & 0x0F) << 4);
+            *p++ = y >> 4;
+            *p++ = data->pad2Strength;
+        }
+    }
+    if (imu_batch)
+    {
+        p = esb_comm_encode_imu_batch(data, p, out + ESB_WIRE_MAX_SIZE);
+    }
+
+    if (keyframe)
+    {
+        g_esb_ctx.tx_since_keyframe = 0;
+        g_esb_ctx.stats.keyframes_sent++;
+    }
+    else
+    {
+        g_esb_ctx.tx_since_keyframe++;
+    }
+
+    return (uint8_t)(p - out);
+}
+
+/**
+ * @brief Arm the sample point for the slot at slot_next_us (slot timer ISR or start)
+ * @return true if the sample point has already passed - the caller notifies right away
+ */
+static bool esb_comm_slot_arm_sample(uint32_t now)
+{
+    // The dongle can shorten the superframe - keep the sample point after this slot's re-arm
+    uint32_t lead_us = MIN(g_esb_ctx.sample_lead_us, g_esb_ctx.slot_period_us - SLOT_TIMER_GUARD_US);
+    uint32_t sample_at = g_esb_ctx.slot_next_us - lead_us;
+
+    if ((int32_t)(sample_at - now) < SLOT_TIMER_GUARD_US)
+    {
+        return true;
+    }
+    nrfx_timer_compare(&slot_timer, NRF_TIMER_CC_CHANNEL3, sample_at, true);
+    return false;
+}
+
+/**
+ * @brief Slot timer ISR - sample point: wake the application; slot start: re-arm and launch the published packet
+ */
+static void esb_comm_slot_timer_handler(nrf_timer_event_t event_type, void *p_context)
+{
+    ARG_UNUSED(p_context);
+
+    if (!g_esb_ctx.slot_timer_running)
+    {
+        return;
+    }
+
+    // The callback only wakes a thread, which samples and publishes before slot_next_us
+    if (event_type == NRF_TIMER_EVENT_COMPARE3)
+    {
+        if (g_esb_ctx.slot_cb)
+        {
+            g_esb_ctx.slot_cb(g_esb_ctx.slot_next_us);
+        }
+        return;
+    }
+
+    if (event_type != NRF_TIMER_EVENT_COMPARE0)
+    {
+        return;
+    }
+
+    // Schedule next slot on the absolute grid, nudged by the phase error the dongle reported
+    int32_t correction = atomic_set(&g_esb_ctx.slot_correction_us, 0);
+    uint32_t now = nrfx_timer_capture(&slot_timer, NRF_TIMER_CC_CHANNEL2);
+
+    g_esb_ctx.slot_next_us += g_esb_ctx.slot_period_us + correction;
+    if ((int32_t)(g_esb_ctx.slot_next_us - now) < SLOT_TIMER_GUARD_US)
+    {
+        // Missed the slot (long ISR latency) - restart the grid from now, the dongle will pull us back in
+        g_esb_ctx.slot_next_us = now + g_esb_ctx.slot_period_us;
+    }
+    nrfx_timer_compare(&slot_timer, NRF_TIMER_CC_CHANNEL0, g_esb_ctx.slot_next_us, true);
+
+    // Sample point already behind us (short period or late ISR) - sample now, it may still make the slot
+    if (esb_comm_slot_arm_sample(now) && g_esb_ctx.slot_cb)
+    {
+        g_esb_ctx.slot_cb(g_esb_ctx.slot_next_us);
+    }
+
+    if (!g_esb_ctx.enabled || !g_esb_ctx.slot_data_valid)
+    {
+        return;
+    }
+
+    // Previous packet still in the air - skip this slot rather than spill into the other half's window
+    if (!esb_is_idle())
+    {
+        g_esb_ctx.stats.slot_skipped_busy++;
+        return;
+    }
+
+    // ISR preempts the radio stage, so the published buffer can't change under us while copying
+    uint32_t idx = atomic_get(&g_esb_ctx.slot_data_idx);
+    const esb_controller_data_t *data = &g_esb_ctx.slot_data[idx];
+    if (esb_comm_write_packet(data) == ESB_COMM_STATUS_OK)
+    {
+        g_esb_ctx.stats.slot_tx_count++;
+
+        // Sample age at launch - a resent snapshot is a full period (or more) old
+        uint32_t age_us = now - g_esb_ctx.slot_data_us[idx];
+        g_esb_ctx.stats.sample_age_us = age_us;
+        g_esb_ctx.stats.sample_age_max_us = MAX(g_esb_ctx.stats.sample_age_max_us, age_us);
+        if (g_esb_ctx.slot_data_seq[idx] == g_esb_ctx.slot_launch_seq)
+        {
+            g_esb_ctx.stats.sample_stale++;
+        }
+        g_esb_ctx.slot_launch_seq = g_esb_ctx.slot_data_seq[idx];
+    }
+}
+
+/**
+ * @brief Initialize the slot timer peripheral (once)
+ */
+static int esb_comm_slot_timer_init(void)
+{
+    if (g_esb_ctx.slot_timer_ready)
+    {
+        return 0;
+    }
+
+    nrfx_timer_config_t timer_cfg = NRFX_TIMER_DEFAULT_CONFIG(1000000);
+    timer_cfg.bit_width = NRF_TIMER_BIT_WIDTH_32;
+
+    IRQ_CONNECT(TIMER1_IRQn, DT_IRQ(DT_NODELABEL(timer1), priority), nrfx_isr, nrfx_timer_1_irq_handler, 0);
+
+    nrfx_err_t err = nrfx_timer_init(&slot_timer, &timer_cfg, esb_comm_slot_timer_handler);
+    if (err != NRFX_SUCCESS)
+    {
+        LOG_ERR("Slot timer init failed: 0x%08x", err);
+        return -EIO;
+    }
+
+    nrfx_timer_enable(&slot_timer);
+    g_esb_ctx.slot_timer_ready = true;
+    return 0;
+}
+
+/**
+ * @brief Arm the first slot - RIGHT starts at slot 0, LEFT one slot later
+ */
+static void esb_comm_slot_timer_start(void)
+{
+    if (!g_esb_ctx.slot_timer_ready)
+    {
+        return;
+    }
+
+    nrfx_timer_enable(&slot_timer);
+
+    uint32_t now = esb_comm_local_time_us();
+    atomic_set(&g_esb_ctx.slot_correction_us, 0);
+    g_esb_ctx.slot_next_us = now + g_esb_ctx.slot_period_us +
+                             (g_esb_ctx.config.controller_id % ESB_TDMA_NUM_SLOTS) * ESB_TDMA_SLOT_US;
+    g_esb_ctx.slot_timer_running = true;
+    nrfx_timer_compare(&slot_timer, NRF_TIMER_CC_CHANNEL0, g_esb_ctx.slot_next_us, true);
+    esb_comm_slot_arm_sample(now);
+
+    LOG_INF("TDMA slot timer started: period=%dus, slot=%d",
+            g_esb_ctx.slot_period_us, g_esb_ctx.config.controller_id);
+}
+
+/**
+ * @brief Stop launching packets from the slot timer
+ */
+static void esb_comm_slot_timer_stop(void)
+{
+    if (!g_esb_ctx.slot_timer_ready)
+    {
+        return;
+    }
+
+    g_esb_ctx.slot_timer_running = false;
+    nrfx_timer_compare_int_disable(&slot_timer, NRF_TIMER_CC_CHANNEL0);
+    nrfx_timer_compare_int_disable(&slot_timer, NRF_TIMER_CC_CHANNEL3);
+    nrfx_timer_disable(&slot_timer);
+}
+
+/**
+ * @brief Clear the clock sync estimator
+ */
+static void esb_comm_clock_sync_reset(void)
+{
+    unsigned int key = irq_lock();
+    memset(&g_clock_sync, 0, sizeof(g_clock_sync));
+    g_esb_ctx.prev_tx_valid = false;
+    irq_unlock(key);
+}
+
+/**
+ * @brief Radio time from handing a packet to ESB until the dongle timestamps it
+ */
+static uint32_t esb_comm_tx_latency_us(uint8_t length)
+{
+    // 2Mbps: preamble(2) + address(5) + payload + CRC(2) bytes + 9 bit DPL control field, 0.5us per bit
+    uint32_t air_bits = (2 + 5 + length + 2) * 8 + 9;
+    return ESB_SYNC_RAMP_UP_US + air_bits / 2 + ESB_SYNC_DONGLE_RX_LATENCY_US;
+}
+
+/**
+ * @brief Refit the sync line over the sample window (called from radio ISR, integer only)
+ */
+static void esb_comm_clock_sync_fit(void)
+{
+    esb_clock_sync_t *cs = &g_clock_sync;
+    uint8_t newest = (cs->head + ESB_SYNC_WINDOW_SIZE - 1) % ESB_SYNC_WINDOW_SIZE;
+    uint32_t ref_local = cs->local_us[newest];
+    uint32_t ref_dongle = cs->dongle_us[newest];
+    int64_t su = 0, sv = 0, suu = 0, suv = 0;
+    int32_t n = cs->count;
+
+    // u = local offset to newest sample, v = dongle offset minus u (deviation from a 1:1 clock)
+    for (int i = 0; i < n; i++)
+    {
+        int32_t u = (int32_t)(cs->local_us[i] - ref_local);
+        int32_t v = (int32_t)(cs->dongle_us[i] - ref_dongle) - u;
+        su += u;
+        sv += v;
+        suu += (int64_t)u * u;
+        suv += (int64_t)u * v;
+    }
+
+    int64_t sxx = n * suu - su * su;
+    int64_t sxy = n * suv - su * sv;
+    int32_t slope_q20 = (n >= 2 && sxx > 0) ? (int32_t)((sxy * (1 << 20)) / sxx) : 0;
+    int32_t intercept = (int32_t)((sv - ((su * slope_q20) >> 20)) / n);
+
+    // Largest residual in the window = timestamp jitter
+    uint32_t jitter = 0;
+    for (int i = 0; i < n; i++)
+    {
+        int32_t u = (int32_t)(cs->local_us[i] - ref_local);
+        int32_t v = (int32_t)(cs->dongle_us[i] - ref_dongle) - u;
+        int32_t err = v - (intercept + (int32_t)(((int64_t)u * slope_q20) >> 20));
+        jitter = MAX(jitter, (uint32_t)abs(err));
+    }
+
+    cs->ref_local_us = ref_local;
+    cs->ref_dongle_us = ref_dongle;
+    cs->slope_q20 = slope_q20;
+    cs->intercept_us = intercept;
+
+    g_esb_ctx.stats.clock_drift_ppb = (int32_t)(((int64_t)slope_q20 * 1000000000LL) >> 20);
+    g_esb_ctx.stats.clock_jitter_us = jitter;
+}
+
+/**
+ * @brief Add one (local, dongle) timestamp pair to the estimator
+ */
+static void esb_comm_clock_sync_add(uint32_t local_us, uint32_t dongle_us)
+{
+    esb_clock_sync_t *cs = &g_clock_sync;
+
+    if (cs->count > 0 && (local_us - cs->last_sample_local_us) < ESB_SYNC_SAMPLE_INTERVAL_US)
+    {
+        return;
+    }
+
+    // Reject samples far off the current line; restart if the dongle clock jumped (dongle reset)
+    if (cs->count >= ESB_SYNC_MIN_SAMPLES)
+    {
+        int32_t err = (int32_t)(dongle_us - esb_comm_local_to_dongle_us(local_us));
+        if (abs(err) > ESB_SYNC_OUTLIER_US)
+        {
+            if (++cs->outliers < ESB_SYNC_MAX_OUTLIERS)
+            {
+                return;
+            }
+            memset(cs, 0, sizeof(*cs));
+            g_esb_ctx.stats.clock_sync_resets++;
+        }
+    }
+
+    cs->outliers = 0;
+    cs->last_sample_local_us = local_us;
+    cs->local_us[cs->head] = local_us;
+    cs->dongle_us[cs->head] = dongle_us;
+    cs->head = (cs->head + 1) % ESB_SYNC_WINDOW_SIZE;
+    if (cs->count < ESB_SYNC_WINDOW_SIZE)
+    {
+        cs->count++;
+    }
+    g_esb_ctx.stats.clock_sync_samples++;
+
+    esb_comm_clock_sync_fit();
+}
+
+/**
+ * @brief Take the rumble amplitude from an ACK payload (called from radio ISR)
+ */
+static void esb_comm_rumble_update(const ack_timing_data_t *ack)
+{
+    if (ack->rumble != g_esb_ctx.current_rumble)
+    {
+        g_esb_ctx.current_rumble = ack->rumble;
+        g_esb_ctx.stats.rumble_updates++;
+
+        // Host report time in dongle time = ACK timestamp - age; a saturated age can't be placed
+        if (esb_comm_is_clock_synced() && ack->rumble_age_us != UINT16_MAX)
+        {
+            uint32_t report_dongle_us = ack->dongle_timestamp - ack->rumble_age_us;
+            uint32_t latency_us = esb_comm_dongle_time_now_us() - report_dongle_us;
+            g_esb_ctx.stats.rumble_latency_us = latency_us;
+            g_esb_ctx.stats.rumble_latency_max_us = MAX(g_esb_ctx.stats.rumble_latency_max_us, latency_us);
+        }
+    }
+
+    if (g_esb_ctx.rumble_cb)
+    {
+        g_esb_ctx.rumble_cb(ack->rumble);
+    }
+}
+
 /**
  * @brief ESB event handler - processes transmission events
  */
@@ -106,29 +669,46 @@ static void esb_comm_event_handler(struct esb_evt const *event)
             // Valid ACK payload received - extract timing and rumble data
             memcpy(&g_esb_ctx.last_ack_data, ack_payload.data, sizeof(ack_timing_data_t));
 
-            // Set next transmission delay from ACK payload (only if valid)
-            if (g_esb_ctx.last_ack_data.next_delay_ms > 0 && g_esb_ctx.last_ack_data.next_delay_ms < 1000) {
-                g_esb_ctx.next_tx_delay_ms = g_esb_ctx.last_ack_data.next_delay_ms;
+            // The dongle queues the ACK payload on reception, so this timestamp belongs to our
+            // previous packet - only pair it if that packet was acknowledged (dongle surely got it)
+            if (g_esb_ctx.prev_tx_valid)
+            {
+                esb_comm_clock_sync_add(g_esb_ctx.prev_tx_local_us, g_esb_ctx.last_ack_data.dongle_timestamp);
+            }
+
+            // Adopt superframe from ACK payload (only if valid) and queue a phase correction
+            uint16_t superframe_us = g_esb_ctx.last_ack_data.superframe_us;
+            if (superframe_us >= ESB_TDMA_NUM_SLOTS * 500 && superframe_us <= 20000) {
+                g_esb_ctx.slot_period_us = superframe_us;
+                g_esb_ctx.next_tx_delay_ms = DIV_ROUND_UP(superframe_us, 1000);
                 g_esb_ctx.ack_timing_active = true;
+
+                // Half-gain correction: the ACK reports the phase of the previous packet, so a
+                // full step would overshoot; with gain 1/2 and one packet of lag the loop settles
+                int32_t correction = -g_esb_ctx.last_ack_data.slot_phase_us / 2;
+                correction = CLAMP(correction, -ESB_TDMA_MAX_CORRECTION_US, ESB_TDMA_MAX_CORRECTION_US);
+                if (g_esb_ctx.ack_timing_enabled) {
+                    atomic_set(&g_esb_ctx.slot_correction_us, correction);
+                }
+                g_esb_ctx.stats.last_slot_phase_us = g_esb_ctx.last_ack_data.slot_phase_us;
             } else {
                 // Invalid timing data in ACK payload
                 g_esb_ctx.ack_timing_active = false;
                 g_esb_ctx.next_tx_delay_ms = g_esb_ctx.config.base_tx_interval_ms;
             }
 
-            // Extract rumble data (upper 4 bits = left motor, lower 4 bits = right motor)
-            g_esb_ctx.current_rumble_left = (g_esb_ctx.last_ack_data.rumble_data >> 4) & 0x0F;
-            g_esb_ctx.current_rumble_right = g_esb_ctx.last_ack_data.rumble_data & 0x0F;
+            // Rumble amplitude for this half - every ACK refreshes the motor envelope
+            esb_comm_rumble_update(&g_esb_ctx.last_ack_data);
 
             // Log ACK payload data occasionally
             static uint32_t last_ack_log = 0;
             uint32_t now = k_uptime_get_32();
             if ((now - last_ack_log) > 5000) {
-                LOG_INF("ACK payload: delay=%dms, seq=%d, rumble=L%d/R%d, dongle_time=%u",
-                        g_esb_ctx.last_ack_data.next_delay_ms,
+                LOG_INF("ACK payload: superframe=%dus, phase=%dus, seq=%d, rumble=%d, dongle_time=%u",
+                        g_esb_ctx.last_ack_data.superframe_us,
+                        g_esb_ctx.last_ack_data.slot_phase_us,
                         g_esb_ctx.last_ack_data.sequence_num,
-                        g_esb_ctx.current_rumble_left,
-                        g_esb_ctx.current_rumble_right,
+                        g_esb_ctx.current_rumble,
                         g_esb_ctx.last_ack_data.dongle_timestamp);
                 last_ack_log = now;
             }
@@ -138,10 +718,32 @@ static void esb_comm_event_handler(struct esb_evt const *event)
             // No valid ACK payload - fall back to fixed timing
             g_esb_ctx.ack_timing_active = false;
             g_esb_ctx.next_tx_delay_ms = g_esb_ctx.config.base_tx_interval_ms;
-            g_esb_ctx.current_rumble_left = 0;
-            g_esb_ctx.current_rumble_right = 0;
         }
 
+        // The slot timer ISR may launch the next packet at any point - it rewrites tx_inflight and
+        // adds to the unacked mask, so the ACK bookkeeping must not interleave with it
+        unsigned int key = irq_lock();
+
+        // Dongle has this state now - future deltas are relative to it
+        memcpy(&g_esb_ctx.tx_baseline, &g_esb_ctx.tx_inflight, sizeof(esb_controller_data_t));
+        g_esb_ctx.tx_baseline_valid = true;
+        g_esb_ctx.tx_unacked_mask = 0; // The acknowledged packet repeated every unconfirmed field
+        g_esb_ctx.tx_unacked_touch = false;
+
+        // Release the IMU samples that packet carried (some may already have been overwritten)
+        int8_t imu_acked = (int8_t)(g_esb_ctx.imu_inflight_end - (uint8_t)(g_esb_ctx.imu_next_seq - g_esb_ctx.imu_pending));
+        if (imu_acked > 0)
+        {
+            g_esb_ctx.imu_pending -= MIN((uint8_t)imu_acked, g_esb_ctx.imu_pending);
+            g_esb_ctx.imu_seq_acked = true;
+        }
+
+        // This packet's arrival time will come back in the next ACK payload
+        g_esb_ctx.prev_tx_local_us = g_esb_ctx.tx_local_us + esb_comm_tx_latency_us(g_esb_ctx.tx_length);
+        g_esb_ctx.prev_tx_valid = true;
+
+        irq_unlock(key);
+
         // Turn off status LED (if configured)
         if (g_esb_ctx.config.status_led)
         {
@@ -157,12 +759,11 @@ static void esb_comm_event_handler(struct esb_evt const *event)
         g_esb_ctx.stats.failed_transmissions++;
         g_esb_ctx.stats.retry_count++;
         g_esb_ctx.last_tx_succeeded = false;
+        g_esb_ctx.prev_tx_valid = false; // Can't tell which packet the next ACK payload belongs to
 
         // On TX failure, disable ACK timing and use retry interval
         g_esb_ctx.ack_timing_active = false;
         g_esb_ctx.next_tx_delay_ms = g_esb_ctx.config.retry_interval_ms;
-        g_esb_ctx.current_rumble_left = 0;
-        g_esb_ctx.current_rumble_right = 0;
 
         // Turn off status LED on failure too
         if (g_esb_ctx.config.status_led)
@@ -258,13 +859,14 @@ esb_comm_status_t esb_comm_driver_init(const esb_comm_config_t *config)
     esb_cfg.protocol = ESB_PROTOCOL_ESB_DPL; // Dynamic payload length
     esb_cfg.mode = ESB_MODE_PTX;             // Controller transmits data continuously
     esb_cfg.retransmit_delay = 600;          // 600us delay between retransmissions
-    esb_cfg.retransmit_count = 2;
+    esb_cfg.retransmit_count = 0;            // No retransmits - a retry would land in the other half's slot; next slot carries fresh data
     esb_cfg.tx_output_power = 8;             // Maximum TX power (8 dBm)
     esb_cfg.event_handler = esb_comm_event_handler;
     esb_cfg.bitrate = ESB_BITRATE_2MBPS;
     esb_cfg.selective_auto_ack = true; // Enable ACK for timing coordination
     esb_cfg.use_fast_ramp_up = false;  // Disable fast ramp up for stability during ADC activity
-    esb_cfg.payload_length = 21;
+    esb_cfg.payload_length = ESB_WIRE_MAX_SIZE;
+    BUILD_ASSERT(ESB_WIRE_MAX_SIZE <= CONFIG_ESB_MAX_PAYLOAD_LENGTH, "Wire packet exceeds ESB payload");
 
     // Set up addresses - Player 1 and Player 2 use different address sets
     // Each player has unique RIGHT (pipe 0) and LEFT (pipe 1) addresses
@@ -342,12 +944,28 @@ esb_comm_status_t esb_comm_driver_init(const esb_comm_config_t *config)
         LOG_INF("Status LED configured for ESB transmission feedback");
     }
 
+    // Slot timer drives transmissions at microsecond resolution
+    esb_comm_clock_sync_reset();
+    g_esb_ctx.tx_baseline_valid = false; // First packet after (re)init is a keyframe
+    g_esb_ctx.tx_unacked_mask = 0;
+    g_esb_ctx.tx_unacked_touch = false;
+    g_esb_ctx.slot_period_us = ESB_TDMA_SUPERFRAME_US;
+    esb_comm_set_sample_lead(config->sample_lead_us);
+    g_esb_ctx.slot_data_valid = false;
+    err = esb_comm_slot_timer_init();
+    if (err)
+    {
+        LOG_WRN("Slot timer unavailable, falling back to millisecond pacing");
+    }
+
     // Initialize state
     g_esb_ctx.initialized = true;
     g_esb_ctx.enabled = true;
     g_esb_ctx.last_tx_attempt = 0;
     g_esb_ctx.last_tx_succeeded = true;
 
+    esb_comm_slot_timer_start();
+
     LOG_INF("ESB communication driver initialized successfully - ready for transmission");
     LOG_INF("Configuration: ID=%d, Base interval=%dms, Retry interval=%dms, RF channel=%d",
             g_esb_ctx.config.controller_id,
@@ -381,6 +999,18 @@ esb_comm_status_t esb_comm_send_data_timed(const esb_controller_data_t *data)
         return ESB_COMM_STATUS_ERROR;
     }
 
+    // Slot timer running: publish for the next slot, the timer ISR does the actual transmission
+    if (g_esb_ctx.slot_timer_running)
+    {
+        uint32_t next_idx = atomic_get(&g_esb_ctx.slot_data_idx) ^ 1;
+        memcpy(&g_esb_ctx.slot_data[next_idx], data, sizeof(esb_controller_data_t));
+        g_esb_ctx.slot_data_us[next_idx] = esb_comm_local_time_us();
+        g_esb_ctx.slot_data_seq[next_idx] = ++g_esb_ctx.slot_publish_seq;
+        atomic_set(&g_esb_ctx.slot_data_idx, next_idx);
+        g_esb_ctx.slot_data_valid = true;
+        return ESB_COMM_STATUS_OK;
+    }
+
     uint32_t now = k_uptime_get_32();
     uint32_t tx_interval;
 
@@ -457,14 +1087,28 @@ esb_comm_status_t esb_comm_send_immediate(const esb_controller_data_t *data)
         return ESB_COMM_STATUS_BUSY;
     }
 
-    // Prepare payload
-    g_esb_ctx.tx_payload.length = sizeof(esb_controller_data_t);
+    return esb_comm_write_packet(data);
+}
+
+/**
+ * @brief Write one packet to the radio (thread or slot timer ISR context)
+ */
+static esb_comm_status_t esb_comm_write_packet(const esb_controller_data_t *data)
+{
+    // Prepare payload - only fields that changed since the last acknowledged packet
     g_esb_ctx.tx_payload.pipe = g_esb_ctx.config.controller_id; // LEFT=1, RIGHT=0
-    memcpy(g_esb_ctx.tx_payload.data, data, sizeof(esb_controller_data_t));
+    memcpy(&g_esb_ctx.tx_inflight, data, sizeof(esb_controller_data_t));
+    g_esb_ctx.imu_inflight_end = g_esb_ctx.imu_next_seq - g_esb_ctx.imu_pending;
+    g_esb_ctx.tx_payload.length = esb_comm_encode_packet(&g_esb_ctx.tx_inflight, g_esb_ctx.tx_payload.data);
+    g_esb_ctx.stats.payload_bytes_sent += g_esb_ctx.tx_payload.length;
 
     // Clear TX buffer first to prevent buffer overload
     esb_flush_tx();
 
+    // Radio starts ramping up inside esb_write_payload - stamp the send time for clock sync
+    g_esb_ctx.tx_local_us = esb_comm_local_time_us();
+    g_esb_ctx.tx_length = g_esb_ctx.tx_payload.length;
+
     // Write payload to radio
     int err = esb_write_payload(&g_esb_ctx.tx_payload);
 
@@ -496,6 +1140,37 @@ esb_comm_status_t esb_comm_send_immediate(const esb_controller_data_t *data)
     return ESB_COMM_STATUS_OK;
 }
 
+/**
+ * @brief Queue IMU samples until a packet carrying them is acknowledged
+ */
+esb_comm_status_t esb_comm_queue_imu_samples(const esb_imu_sample_t *samples, uint8_t count)
+{
+    if (!samples)
+    {
+        return ESB_COMM_STATUS_ERROR;
+    }
+
+    // Slot timer ISR encodes from this queue - keep the update atomic
+    unsigned int key = irq_lock();
+    for (uint8_t i = 0; i < count; i++)
+    {
+        g_esb_ctx.imu_queue[g_esb_ctx.imu_next_seq % ESB_IMU_QUEUE_SIZE] = samples[i];
+        g_esb_ctx.imu_next_seq++;
+        if (g_esb_ctx.imu_pending < ESB_IMU_QUEUE_SIZE)
+        {
+            g_esb_ctx.imu_pending++;
+        }
+        else
+        {
+            g_esb_ctx.stats.imu_samples_dropped++; // Oldest sample overwritten
+        }
+    }
+    g_esb_ctx.stats.imu_samples_queued += count;
+    irq_unlock(key);
+
+    return ESB_COMM_STATUS_OK;
+}
+
 /**
  * @brief Send controller data via ESB (standard interface)
  */
@@ -601,6 +1276,7 @@ esb_comm_status_t esb_comm_enter_sleep(void)
     }
 
     LOG_INF("ESB entering sleep mode");
+    esb_comm_slot_timer_stop();
     esb_disable();
     g_esb_ctx.enabled = false;
 
@@ -625,8 +1301,10 @@ esb_comm_status_t esb_comm_wakeup(void)
 
     LOG_INF("ESB waking up from sleep mode");
 
-    // Re-initialize ESB with current configuration
-    esb_comm_status_t status = esb_comm_driver_init(&g_esb_ctx.config);
+    // Re-initialize ESB with current configuration (init skips if still flagged initialized)
+    esb_comm_config_t config = g_esb_ctx.config;
+    g_esb_ctx.initialized = false;
+    esb_comm_status_t status = esb_comm_driver_init(&config);
     if (status != ESB_COMM_STATUS_OK)
     {
         LOG_ERR("Failed to re-initialize ESB after wakeup: %d", status);
@@ -636,6 +1314,34 @@ esb_comm_status_t esb_comm_wakeup(void)
     return ESB_COMM_STATUS_OK;
 }
 
+/**
+ * @brief Tear the radio down and re-initialize it with the current configuration
+ */
+esb_comm_status_t esb_comm_reset(void)
+{
+    if (!g_esb_ctx.initialized)
+    {
+        return ESB_COMM_STATUS_NOT_INITIALIZED;
+    }
+
+    LOG_WRN("ESB reset - tearing down and re-initializing");
+
+    // Same teardown as sleep, then clear initialized so init doesn't skip
+    esb_comm_slot_timer_stop();
+    esb_disable();
+    g_esb_ctx.enabled = false;
+
+    esb_comm_config_t config = g_esb_ctx.config;
+    g_esb_ctx.initialized = false;
+    esb_comm_status_t status = esb_comm_driver_init(&config);
+    if (status != ESB_COMM_STATUS_OK)
+    {
+        LOG_ERR("Failed to re-initialize ESB after reset: %d", status);
+    }
+
+    return status;
+}
+
 /**
  * @brief Get current ESB communication status
  */
@@ -678,19 +1384,45 @@ esb_comm_status_t esb_comm_enable_ack_timing(bool enable)
 /**
  * @brief Get current rumble data from last ACK payload
  */
-esb_comm_status_t esb_comm_get_rumble_data(uint8_t *left_motor, uint8_t *right_motor)
+esb_comm_status_t esb_comm_get_rumble_data(uint8_t *amplitude)
 {
-    if (!left_motor || !right_motor)
+    if (!amplitude)
     {
         return ESB_COMM_STATUS_ERROR;
     }
 
-    *left_motor = g_esb_ctx.current_rumble_left;
-    *right_motor = g_esb_ctx.current_rumble_right;
+    *amplitude = g_esb_ctx.current_rumble;
 
     return ESB_COMM_STATUS_OK;
 }
 
+/**
+ * @brief Register a callback for the rumble amplitude in every ACK payload
+ */
+esb_comm_status_t esb_comm_register_rumble_callback(esb_comm_rumble_callback_t callback)
+{
+    g_esb_ctx.rumble_cb = callback;
+    return ESB_COMM_STATUS_OK;
+}
+
+/**
+ * @brief Register a callback that fires the sample lead before every TDMA slot
+ */
+esb_comm_status_t esb_comm_register_slot_callback(esb_comm_slot_callback_t callback)
+{
+    g_esb_ctx.slot_cb = callback;
+    return ESB_COMM_STATUS_OK;
+}
+
+/**
+ * @brief Set the slot callback lead before each TX slot
+ */
+esb_comm_status_t esb_comm_set_sample_lead(uint32_t lead_us)
+{
+    g_esb_ctx.sample_lead_us = (lead_us != 0) ? lead_us : ESB_TDMA_SAMPLE_LEAD_US;
+    return ESB_COMM_STATUS_OK;
+}
+
 /**
  * @brief Get dongle timestamp from last ACK payload
  */
@@ -699,6 +1431,62 @@ uint32_t esb_comm_get_dongle_timestamp(void)
     return g_esb_ctx.last_ack_data.dongle_timestamp;
 }
 
+/**
+ * @brief Get the local microsecond timebase
+ */
+uint32_t esb_comm_local_time_us(void)
+{
+    if (!g_esb_ctx.slot_timer_ready)
+    {
+        return k_cyc_to_us_floor32(k_cycle_get_32());
+    }
+
+    // Capture + read must not be split by another context using the same channel
+    unsigned int key = irq_lock();
+    uint32_t now = nrfx_timer_capture(&slot_timer, NRF_TIMER_CC_CHANNEL1);
+    irq_unlock(key);
+
+    return now;
+}
+
+/**
+ * @brief Convert local time to dongle time
+ */
+uint32_t esb_comm_local_to_dongle_us(uint32_t local_us)
+{
+    unsigned int key = irq_lock();
+    int32_t d = (int32_t)(local_us - g_clock_sync.ref_local_us);
+    uint32_t dongle_us = g_clock_sync.ref_dongle_us + d + g_clock_sync.intercept_us +
+                         (int32_t)(((int64_t)d * g_clock_sync.slope_q20) >> 20);
+    irq_unlock(key);
+
+    return dongle_us;
+}
+
+/**
+ * @brief Get the estimated current dongle time
+ */
+uint32_t esb_comm_dongle_time_now_us(void)
+{
+    return esb_comm_local_to_dongle_us(esb_comm_local_time_us());
+}
+
+/**
+ * @brief Check if the clock sync estimator is trusted
+ */
+bool esb_comm_is_clock_synced(void)
+{
+    return g_clock_sync.count >= ESB_SYNC_MIN_SAMPLES;
+}
+
+/**
+ * @brief Check if the TDMA slot timer is driving transmissions
+ */
+bool esb_comm_is_slot_timer_active(void)
+{
+    return g_esb_ctx.slot_timer_running;
+}
+
 /**
  * @brief Get next transmission delay from last ACK payload
  */
@@ -28,13 +28,40 @@ typedef enum {
     ESB_COMM_STATUS_BUSY = -6
 } esb_comm_status_t;
 
+// TDMA slot layout (must match dongle controller_esb.h)
+// Each superframe is split into one slot per controller half: RIGHT=slot 0 (pipe 0), LEFT=slot 1 (pipe 1)
+#define ESB_TDMA_SUPERFRAME_US      2000    // One packet per half every 2ms (500Hz per half)
+#define ESB_TDMA_SLOT_US            1000    // Slot width per controller half
+#define ESB_TDMA_NUM_SLOTS          2       // RIGHT + LEFT
+#define ESB_TDMA_ARRIVAL_OFFSET_US  300     // Target arrival point inside a slot (leaves room for ramp-up + airtime)
+#define ESB_TDMA_MAX_CORRECTION_US  200     // Largest phase step applied to the slot timer per ACK
+#define ESB_TDMA_SAMPLE_LEAD_US     400     // Default sample-and-pack lead before our slot (wake + sample + publish)
+
+// Clock sync estimator (controller local time -> dongle time)
+#define ESB_SYNC_WINDOW_SIZE        32      // Samples in the regression window
+#define ESB_SYNC_SAMPLE_INTERVAL_US 20000   // Decimate ACK timestamps to one sample per 20ms (~640ms window)
+#define ESB_SYNC_MIN_SAMPLES        4       // Samples required before the estimate is trusted
+#define ESB_SYNC_RAMP_UP_US         140     // Radio TX ramp-up (normal ramp, fast ramp-up disabled)
+#define ESB_SYNC_DONGLE_RX_LATENCY_US 20    // Dongle END event -> RX handler timestamp
+#define ESB_SYNC_OUTLIER_US         1000    // Prediction error that marks a sample as an outlier
+#define ESB_SYNC_MAX_OUTLIERS       3       // Consecutive outliers before the estimator restarts
+
 // ACK timing data structure (received from dongle in ACK payload)
 typedef struct {
-    uint16_t next_delay_ms;      // 2 bytes: 0-65535ms timing control
+    uint16_t superframe_us;      // 2 bytes: TDMA superframe period in microseconds
+    int16_t slot_phase_us;       // 2 bytes: measured arrival error vs. our slot target (+ = late, - = early)
     uint8_t sequence_num;        // 1 byte: debugging/sync tracking
-    uint8_t rumble_data;         // 1 byte: rumble control (upper 4 bits=left motor, lower 4 bits=right motor)
-    uint32_t dongle_timestamp;   // 4 bytes: dongle time sync
-} __packed ack_timing_data_t;   // Total: 8 bytes
+    uint8_t rumble;              // 1 byte: host motor amplitude for this half (0 = off, 255 = full)
+    uint32_t dongle_timestamp;   // 4 bytes: dongle time sync (microseconds)
+    uint16_t rumble_age_us;      // 2 bytes: time from the host setting the amplitude to dongle_timestamp
+} __packed ack_timing_data_t;   // Total: 12 bytes
+
+// Called from the radio ISR for every ACK payload - keep it short
+typedef void (*esb_comm_rumble_callback_t)(uint8_t amplitude);
+
+// Called from the slot timer ISR the sample lead before every slot of ours - keep it short
+// next_slot_us is when that slot starts (the packet launches), in esb_comm_local_time_us() time
+typedef void (*esb_comm_slot_callback_t)(uint32_t next_slot_us);
 
 // Controller data structure for transmission
 typedef struct
@@ -52,8 +79,63 @@ typedef struct
     int16_t gyroX;   // IMU gyroscope X (-32768 to 32767)
     int16_t gyroY;   // IMU gyroscope Y (-32768 to 32767)
     int16_t gyroZ;   // IMU gyroscope Z (-32768 to 32767)
+    uint8_t touch;        // Trackpad frame: latest gesture, finger count, gesture counter (ESB_TOUCH_*)
+    uint8_t padStrength;  // Finger 1 touch strength (raw >> 4, saturated)
+    int16_t pad2X;        // Trackpad finger 2 X (0 when not touching)
+    int16_t pad2Y;        // Trackpad finger 2 Y
+    uint8_t pad2Strength; // Finger 2 touch strength
 } __packed esb_controller_data_t;
 
+// Variable-length wire format (must match dongle controller_esb.h)
+// Byte 0: bits 7-4 = wire version, bit 2 = IMU sequence restarted, bit 1 = touch block present,
+// bit 0 = keyframe (all fields present)
+// Byte 1: change mask, then each flagged field in mask bit order (little-endian), the touch block,
+// and the IMU batch last
+// Fields carry absolute values, so a repeated/duplicated delta is harmless; fields sent since the
+// last ACK are repeated until one is acknowledged, so a lost ACK never leaves the dongle stale
+#define ESB_WIRE_VERSION         3
+#define ESB_WIRE_HEADER_SIZE     2
+#define ESB_WIRE_KEYFRAME        0x01
+#define ESB_WIRE_EXT_TOUCH       0x02
+#define ESB_WIRE_IMU_RESTART     0x04    // Set until the first IMU batch since boot is acknowledged
+#define ESB_WIRE_FIELD_FLAGS     0x01    // flags (1 byte)
+#define ESB_WIRE_FIELD_TRIGGER   0x02    // trigger (1 byte)
+#define ESB_WIRE_FIELD_STICK     0x04    // stickX, stickY (2 bytes)
+#define ESB_WIRE_FIELD_PAD       0x08    // padX, padY (4 bytes)
+#define ESB_WIRE_FIELD_BUTTONS   0x10    // buttons (1 byte)
+#define ESB_WIRE_FIELD_ACCEL     0x20    // accelX/Y/Z (6 bytes)
+#define ESB_WIRE_FIELD_GYRO      0x40    // gyroX/Y/Z (6 bytes)
+#define ESB_WIRE_FIELD_ALL       0x7F
+#define ESB_WIRE_FIELD_IMU_BATCH 0x80    // IMU sample batch (last sample replaces accel/gyro)
+#define ESB_WIRE_MAX_SIZE        64      // Must not exceed CONFIG_ESB_MAX_PAYLOAD_LENGTH
+#define ESB_WIRE_KEYFRAME_INTERVAL 50    // Force a full packet every 50 packets (~100ms) for resync
+
+// Touch block: [touch][padStrength], then with two fingers [pad2X/pad2Y as 2 x 12 bits][pad2Strength]
+#define ESB_TOUCH_GESTURE_MASK   0x0F    // iqs7211e_gestures_e of the latest gesture
+#define ESB_TOUCH_FINGERS_SHIFT  4
+#define ESB_TOUCH_FINGERS_MASK   0x30    // Fingers on the pad (0-2)
+#define ESB_TOUCH_COUNT_SHIFT    6
+#define ESB_TOUCH_COUNT_MASK     0xC0    // Gesture counter - a change means a new gesture
+#define ESB_WIRE_TOUCH_SIZE(touch) \
+    ((((touch) & ESB_TOUCH_FINGERS_MASK) >> ESB_TOUCH_FINGERS_SHIFT) >= 2 ? 6 : 2)
+
+// IMU batch: [first_seq][count][full_flags], sample 0 as 6 x int16, then each further sample as
+// 6 x int8 deltas to the previous one, or 6 x int16 if its bit in full_flags is set (delta overflow)
+// Order per sample: accelX, accelY, accelZ, gyroX, gyroY, gyroZ
+#define ESB_WIRE_IMU_HEADER_SIZE 3
+#define ESB_WIRE_IMU_BATCH_MAX   8       // Samples per packet (full_flags is one byte)
+#define ESB_IMU_QUEUE_SIZE       32      // Unacknowledged samples kept for resend (power of 2)
+
+// One IMU sample in controller output units
+typedef struct {
+    int16_t accelX;
+    int16_t accelY;
+    int16_t accelZ;
+    int16_t gyroX;
+    int16_t gyroY;
+    int16_t gyroZ;
+} __packed esb_imu_sample_t;
+
 // ESB communication configuration
 typedef struct {
     uint8_t controller_id;           // 0=RIGHT, 1=LEFT
@@ -61,6 +143,7 @@ typedef struct {
     uint32_t retry_interval_ms;      // Retry interval on failed TX (default 16ms)
     uint8_t rf_channel;              // RF channel (default 1)
     const struct gpio_dt_spec *status_led; // Optional status LED
+    uint32_t sample_lead_us;         // Slot callback lead before each TX slot (0 = ESB_TDMA_SAMPLE_LEAD_US)
 } esb_comm_config_t;
 
 // ESB communication statistics
@@ -72,6 +155,23 @@ typedef struct {
     float success_rate;
     uint32_t last_tx_timestamp;
     bool last_tx_succeeded;
+    uint32_t slot_tx_count;          // Packets launched from the TDMA slot timer
+    uint32_t slot_skipped_busy;      // Slots skipped because the radio was still busy
+    int16_t last_slot_phase_us;      // Last slot phase error reported by the dongle
+    int32_t clock_drift_ppb;         // Dongle clock rate vs. local clock (parts per billion)
+    uint32_t clock_jitter_us;        // Largest fit residual in the current sync window
+    uint32_t clock_sync_samples;     // Timestamp pairs accepted by the sync estimator
+    uint32_t clock_sync_resets;      // Estimator restarts (dongle reset / persistent outliers)
+    uint32_t keyframes_sent;         // Full packets sent (periodic or no acknowledged baseline)
+    uint32_t payload_bytes_sent;     // Wire bytes handed to the radio (average size = bytes / total)
+    uint32_t imu_samples_queued;     // IMU samples handed to the driver
+    uint32_t imu_samples_dropped;    // Unacknowledged samples overwritten by newer ones
+    uint32_t rumble_updates;         // ACKs that changed the rumble amplitude
+    uint32_t rumble_latency_us;      // Host report -> ACK received, for the last measured change
+    uint32_t rumble_latency_max_us;  // Worst rumble latency seen
+    uint32_t sample_age_us;          // Slot packets: snapshot published -> packet launched, last packet
+    uint32_t sample_age_max_us;      // Worst sample age seen
+    uint32_t sample_stale;           // Slots that resent a snapshot already launched (publish missed the slot)
 } esb_comm_stats_t;
 
 // Function prototypes
@@ -99,12 +199,23 @@ esb_comm_status_t esb_comm_send_data(const esb_controller_data_t *data);
 
 /**
  * Send controller data via ESB (non-blocking)
- * This function only transmits if enough time has passed since last attempt
+ * With the TDMA slot timer running the data is only published and goes out at the
+ * start of the next slot; otherwise it transmits if enough time has passed since last attempt
  * @param data Pointer to controller data to transmit
  * @return ESB_COMM_STATUS_OK if transmitted, other codes if skipped or failed
  */
 esb_comm_status_t esb_comm_send_data_timed(const esb_controller_data_t *data);
 
+/**
+ * Queue IMU samples for transmission
+ * Samples stay queued until a packet carrying them is acknowledged, so every
+ * sample since the last successful TX goes out with the next packet
+ * @param samples Samples in capture order (oldest first)
+ * @param count Number of samples
+ * @return ESB_COMM_STATUS_OK on success, error code on failure
+ */
+esb_comm_status_t esb_comm_queue_imu_samples(const esb_imu_sample_t *samples, uint8_t count);
+
 /**
  * Get current transmission statistics
  * @param stats Pointer to store statistics
@@ -145,6 +256,12 @@ esb_comm_status_t esb_comm_enter_sleep(void);
  */
 esb_comm_status_t esb_comm_wakeup(void);
 
+/**
+ * Tear the radio down and re-initialize it with the current configuration (callbacks are kept)
+ * @return ESB_COMM_STATUS_OK on success, ESB_COMM_STATUS_NOT_INITIALIZED if never initialized
+ */
+esb_comm_status_t esb_comm_reset(void);
+
 /**
  * Get current ESB communication status
  * @return true if enabled and ready for transmission, false otherwise
@@ -172,12 +289,37 @@ uint32_t esb_comm_get_last_tx_time(void);
 bool esb_comm_get_last_tx_success(void);
 
 /**
- * Get current rumble motor values (from last ACK payload)
- * @param left_motor Pointer to store left motor intensity (0-15)
- * @param right_motor Pointer to store right motor intensity (0-15)
+ * Get current rumble motor value for this half (from last ACK payload)
+ * @param amplitude Pointer to store motor amplitude (0-255)
+ * @return ESB_COMM_STATUS_OK on success, error code on failure
+ */
+esb_comm_status_t esb_comm_get_rumble_data(uint8_t *amplitude);
+
+/**
+ * Register a callback for the rumble amplitude carried by every ACK payload
+ * Latency from the host report to the ACK is measured into the stats when the clock is synced
+ * @param callback Called from the radio ISR (NULL to disable)
+ * @return ESB_COMM_STATUS_OK on success, error code on failure
+ */
+esb_comm_status_t esb_comm_register_rumble_callback(esb_comm_rumble_callback_t callback);
+
+/**
+ * Register a callback that fires the sample lead before every TDMA slot of ours
+ * Data sampled and published from the callback's wake-up goes out at next_slot_us,
+ * so the lead only has to cover wake-up + sampling + publish.
+ * No ticks arrive while the slot timer is stopped (sleep, fallback pacing)
+ * @param callback Called from the slot timer ISR (NULL to disable)
+ * @return ESB_COMM_STATUS_OK on success, error code on failure
+ */
+esb_comm_status_t esb_comm_register_slot_callback(esb_comm_slot_callback_t callback);
+
+/**
+ * Set how long before each TX slot the slot callback fires
+ * Clamped below the superframe period at each slot; takes effect from the next slot
+ * @param lead_us Lead in microseconds (0 = ESB_TDMA_SAMPLE_LEAD_US)
  * @return ESB_COMM_STATUS_OK on success, error code on failure
  */
-esb_comm_status_t esb_comm_get_rumble_data(uint8_t *left_motor, uint8_t *right_motor);
+esb_comm_status_t esb_comm_set_sample_lead(uint32_t lead_us);
 
 /**
  * Get the last received ACK timing data
@@ -205,6 +347,44 @@ esb_comm_status_t esb_comm_enable_ack_timing(bool enable);
  */
 uint16_t esb_comm_get_next_delay(void);
 
+/**
+ * Get dongle timestamp from last ACK payload
+ * @return dongle time in microseconds when it received our previous packet
+ */
+uint32_t esb_comm_get_dongle_timestamp(void);
+
+/**
+ * Convert a local timestamp to dongle time using the clock sync estimator
+ * @param local_us local time from esb_comm_local_time_us()
+ * @return estimated dongle time in microseconds - local_us unchanged before the first sample,
+ *         a fit over fewer samples until esb_comm_is_clock_synced() reports true
+ */
+uint32_t esb_comm_local_to_dongle_us(uint32_t local_us);
+
+/**
+ * Get the current dongle time
+ * @return estimated dongle time in microseconds
+ */
+uint32_t esb_comm_dongle_time_now_us(void);
+
+/**
+ * Check if the clock sync estimator has enough samples to be trusted
+ * @return true if synchronized with the dongle clock
+ */
+bool esb_comm_is_clock_synced(void);
+
+/**
+ * Get the local microsecond timebase used by the TDMA slot timer
+ * @return free-running local time in microseconds (wraps at 32 bits)
+ */
+uint32_t esb_comm_local_time_us(void);
+
+/**
+ * Check if transmissions are being launched from the TDMA slot timer
+ * @return true if slot timer is running, false if using millisecond pacing
+ */
+bool esb_comm_is_slot_timer_active(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -5,6 +5,8 @@
 
 #include "haptic_driver.h"
 #include "drv2605.h"
+#include "i2c_bus_driver.h"
+#include <string.h>
 
 LOG_MODULE_REGISTER(haptic_driver, LOG_LEVEL_ERR);
 
@@ -21,6 +23,240 @@ static haptic_context_t haptic_ctx = {
 // DRV2605 I2C address
 #define DRV2605_I2C_ADDR 0x5A
 
+#define HAPTIC_MODE_HOME    0xFF    // Device is in its configured mode (external trigger or internal)
+#define HAPTIC_GO_POLL_MS   5       // GO bit poll period while a waveform step finishes
+
+// Effect scheduler - requests are posted by callers, everything else runs on the haptic work queue
+static struct {
+    struct k_work_q workq;
+    struct k_work request_work;             // Picks up a pending effect or stop request
+    struct k_work_delayable step_work;      // Ends the current step and starts the next
+    bool started;
+
+    // Shared with callers, guarded by lock
+    struct k_spinlock lock;
+    haptic_step_t pending_steps[HAPTIC_MAX_STEPS];
+    uint8_t pending_count;                  // 0 = nothing pending
+    haptic_priority_t pending_priority;
+    bool stop_requested;
+    bool active;
+    haptic_priority_t active_priority;
+    haptic_sched_stats_t stats;
+
+    // Work queue only
+    haptic_step_t steps[HAPTIC_MAX_STEPS];
+    uint8_t step_count;
+    uint8_t step_index;
+    uint8_t mode;                           // DRV2605 mode set by the current effect, HAPTIC_MODE_HOME if untouched
+} sched = {
+    .mode = HAPTIC_MODE_HOME
+};
+
+K_THREAD_STACK_DEFINE(haptic_workq_stack, HAPTIC_WORKQ_STACK_SIZE);
+
+/**
+ * @brief Switch the DRV2605 to mode for an I2C driven step
+ */
+static int haptic_sched_set_mode(uint8_t mode)
+{
+    if (sched.mode == mode) {
+        return 0;
+    }
+    int ret = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, DRV2605_REG_MODE, mode);
+    if (ret == 0) {
+        sched.mode = mode;
+    }
+    return ret;
+}
+
+/**
+ * @brief Put the DRV2605 back in its configured mode after I2C driven steps
+ */
+static void haptic_sched_restore_mode(void)
+{
+    if (sched.mode == HAPTIC_MODE_HOME) {
+        return;
+    }
+
+    if (haptic_ctx.external_trigger_mode) {
+        // Waveform steps overwrote the trigger effect in slot 0
+        uint8_t slots[] = { DRV2605_REG_WAVESEQ1, haptic_ctx.current_effect, 0x00 };
+        i2c_bus_write(I2C_BUS_CLIENT_HAPTICS, slots, sizeof(slots), DRV2605_I2C_ADDR);
+        i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, DRV2605_REG_MODE, DRV2605_MODE_EXTERNAL);
+    } else {
+        i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, DRV2605_REG_MODE, DRV2605_MODE_INTERNAL);
+    }
+    sched.mode = HAPTIC_MODE_HOME;
+}
+
+/**
+ * @brief Start driving one step
+ */
+static void haptic_sched_start_step(const haptic_step_t *step)
+{
+    switch (step->type) {
+        case HAPTIC_STEP_PULSE:
+            // The trigger pin only works in the configured mode
+            haptic_sched_restore_mode();
+            if (haptic_ctx.trigger_pin) {
+                gpio_pin_set_dt(haptic_ctx.trigger_pin, 1);
+            }
+            break;
+
+        case HAPTIC_STEP_WAVEFORM: {
+            uint8_t buf[1 + HAPTIC_WAVEFORM_SLOTS];
+            size_t len = 1;
+
+            buf[0] = DRV2605_REG_WAVESEQ1;
+            for (int i = 0; i < HAPTIC_WAVEFORM_SLOTS; i++) {
+                buf[len++] = step->waveforms[i];
+                if (step->waveforms[i] == 0) {
+                    break;
+                }
+            }
+            if (haptic_sched_set_mode(DRV2605_MODE_INTERNAL) == 0 &&
+                i2c_bus_write(I2C_BUS_CLIENT_HAPTICS, buf, len, DRV2605_I2C_ADDR) == 0) {
+                i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, DRV2605_REG_GO, 0x01);
+            }
+            break;
+        }
+
+        case HAPTIC_STEP_RTP:
+            if (haptic_sched_set_mode(DRV2605_MODE_RTP) == 0) {
+                i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, DRV2605_REG_RTP_INPUT, step->level);
+            }
+            break;
+
+        case HAPTIC_STEP_PAUSE:
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Stop driving one step - cut is set when a newer effect interrupts it
+ */
+static void haptic_sched_end_step(const haptic_step_t *step, bool cut)
+{
+    switch (step->type) {
+        case HAPTIC_STEP_PULSE:
+            if (haptic_ctx.trigger_pin) {
+                gpio_pin_set_dt(haptic_ctx.trigger_pin, 0);
+            }
+            break;
+
+        case HAPTIC_STEP_WAVEFORM:
+            // A finished sequence clears GO by itself
+            if (cut) {
+                i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, DRV2605_REG_GO, 0x00);
+            }
+            break;
+
+        case HAPTIC_STEP_RTP:
+            i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, DRV2605_REG_RTP_INPUT, 0x00);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Start the step at step_index or finish the effect
+ */
+static void haptic_sched_run_step(void)
+{
+    if (sched.step_index >= sched.step_count) {
+        haptic_sched_restore_mode();
+
+        k_spinlock_key_t key = k_spin_lock(&sched.lock);
+        // A request posted meanwhile is picked up by request_work, leave active to it
+        if (sched.pending_count == 0) {
+            sched.active = false;
+        }
+        sched.stats.played++;
+        k_spin_unlock(&sched.lock, key);
+        return;
+    }
+
+    const haptic_step_t *step = &sched.steps[sched.step_index];
+    haptic_sched_start_step(step);
+    k_work_reschedule_for_queue(&sched.workq, &sched.step_work, K_USEC(step->duration_us));
+}
+
+static void haptic_step_work_handler(struct k_work *work)
+{
+    ARG_UNUSED(work);
+
+    const haptic_step_t *step = &sched.steps[sched.step_index];
+
+    // A waveform step lasts until the sequencer clears GO
+    if (step->type == HAPTIC_STEP_WAVEFORM) {
+        uint8_t go = 0;
+        if (i2c_bus_reg_read_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, DRV2605_REG_GO, &go) == 0 &&
+            (go & 0x01)) {
+            k_work_reschedule_for_queue(&sched.workq, &sched.step_work, K_MSEC(HAPTIC_GO_POLL_MS));
+            return;
+        }
+    }
+
+    haptic_sched_end_step(step, false);
+    sched.step_index++;
+    haptic_sched_run_step();
+}
+
+static void haptic_request_work_handler(struct k_work *work)
+{
+    ARG_UNUSED(work);
+
+    k_spinlock_key_t key = k_spin_lock(&sched.lock);
+    bool requested = sched.pending_count > 0 || sched.stop_requested;
+    bool next_is_rtp = sched.pending_count > 0 && sched.pending_steps[0].type == HAPTIC_STEP_RTP;
+    k_spin_unlock(&sched.lock, key);
+
+    if (!requested) {
+        return;
+    }
+
+    // Cut the playing effect first, the new steps overwrite it. Step work only runs on
+    // this queue, so here it is idle or queued - never running.
+    bool was_playing = sched.step_index < sched.step_count;
+    bool rtp_continues = false;
+    if (was_playing) {
+        const haptic_step_t *step = &sched.steps[sched.step_index];
+
+        // RTP into RTP is an envelope update - keep driving instead of dropping to zero
+        rtp_continues = step->type == HAPTIC_STEP_RTP && next_is_rtp;
+        k_work_cancel_delayable(&sched.step_work);
+        if (!rtp_continues) {
+            haptic_sched_end_step(step, true);
+        }
+    }
+
+    key = k_spin_lock(&sched.lock);
+    uint8_t count = sched.pending_count;
+    if (count > 0) {
+        memcpy(sched.steps, sched.pending_steps, count * sizeof(haptic_step_t));
+        sched.active_priority = sched.pending_priority;
+        sched.pending_count = 0;
+    } else {
+        sched.active = false;
+    }
+    sched.stop_requested = false;
+    if (was_playing && !rtp_continues) {
+        sched.stats.preempted++;
+    }
+    k_spin_unlock(&sched.lock, key);
+
+    sched.step_count = count;
+    sched.step_index = 0;
+    if (count == 0) {
+        haptic_sched_restore_mode();
+        return;
+    }
+    haptic_sched_run_step();
+}
+
 /**
  * @brief Initialize the haptic driver system
  */
@@ -80,7 +316,7 @@ int haptic_driver_init(const struct device *i2c_dev,
     
     // Try to detect DRV2605
     uint8_t test_data = 0;
-    int scan_ret = i2c_reg_read_byte(i2c_dev, DRV2605_I2C_ADDR, 0x00, &test_data);
+    int scan_ret = i2c_bus_reg_read_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x00, &test_data);
     LOG_INF("DRV2605 detection: ret=%d, status=0x%02X", scan_ret, test_data);
     
     if (scan_ret != 0) {
@@ -97,6 +333,18 @@ int haptic_driver_init(const struct device *i2c_dev,
     
     haptic_ctx.status = HAPTIC_STATUS_READY;
     
+    // Effect scheduler - effects play from here so no caller sleeps between edges
+    if (!sched.started) {
+        const struct k_work_queue_config workq_cfg = { .name = "haptic" };
+
+        k_work_init(&sched.request_work, haptic_request_work_handler);
+        k_work_init_delayable(&sched.step_work, haptic_step_work_handler);
+        k_work_queue_init(&sched.workq);
+        k_work_queue_start(&sched.workq, haptic_workq_stack, K_THREAD_STACK_SIZEOF(haptic_workq_stack),
+                           K_PRIO_PREEMPT(HAPTIC_WORKQ_PRIORITY), &workq_cfg);
+        sched.started = true;
+    }
+    
     LOG_INF("=== HAPTIC DRIVER INIT COMPLETE ===");
     return 0;
 }
@@ -130,24 +378,24 @@ int haptic_setup_external_trigger(drv2605_effect_t default_effect)
     
     // Step 1: Exit standby mode
     LOG_DBG("Step 1 - Exit standby mode");
-    int ret1 = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x01, 0x00);
+    int ret1 = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x01, 0x00);
     k_sleep(K_MSEC(5));
     
     // Step 2: Set motor library (detect if LRA or ERM mode was used)
     LOG_DBG("Step 2 - Set motor library");
     uint8_t feedback_reg = 0;
-    int lib_ret = i2c_reg_read_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x1A, &feedback_reg);
+    int lib_ret = i2c_bus_reg_read_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x1A, &feedback_reg);
     int ret2 = 0;
     
     if (lib_ret == 0 && (feedback_reg & 0x80)) {
         // LRA mode detected (bit 7 set)
         LOG_INF("LRA mode detected - using LRA library");
-        ret2 = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x03, 0x06); // LRA Library
+        ret2 = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x03, 0x06); // LRA Library
         k_sleep(K_MSEC(5));
     } else {
         // ERM mode (bit 7 clear or read failed)
         LOG_INF("ERM mode detected - using ERM library");
-        ret2 = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x03, 0x01); // ERM Library
+        ret2 = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x03, 0x01); // ERM Library
         k_sleep(K_MSEC(5));
     }
     
@@ -157,43 +405,43 @@ int haptic_setup_external_trigger(drv2605_effect_t default_effect)
     
     // Verify calibration values are still present after motor setup
     uint8_t comp_check = 0, bemf_check = 0;
-    if (i2c_reg_read_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x18, &comp_check) == 0 &&
-        i2c_reg_read_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x19, &bemf_check) == 0) {
+    if (i2c_bus_reg_read_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x18, &comp_check) == 0 &&
+        i2c_bus_reg_read_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x19, &bemf_check) == 0) {
         LOG_INF("Calibration verification: Comp=0x%02X, BackEMF=0x%02X", comp_check, bemf_check);
     }
     
     // Step 3: Set default waveform
     LOG_DBG("Step 3 - Set default waveform");
-    int ret3 = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x04, default_effect);
+    int ret3 = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x04, default_effect);
     k_sleep(K_MSEC(2));
     
     // Step 4: End sequence
     LOG_DBG("Step 4 - End sequence");
-    int ret4 = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x05, 0x00);
+    int ret4 = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x05, 0x00);
     k_sleep(K_MSEC(2));
     
     // Step 5: Set external trigger mode
     LOG_DBG("Step 5 - Set external trigger mode");
-    int ret5 = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x01, 0x01);
+    int ret5 = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x01, 0x01);
     k_sleep(K_MSEC(5));
     
     // Step 6: Boost motor strength with enhanced control register settings
     LOG_DBG("Step 6 - Apply strength boost settings");
     
     // Control1: Enhanced startup boost and drive strength
-    int ret6a = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x1B, 0xB3); // Higher startup boost
+    int ret6a = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x1B, 0xB3); // Higher startup boost
     if (ret6a != 0) {
         LOG_WRN("Failed to set enhanced Control1: %d", ret6a);
     }
     
     // Control2: Bidirectional input with optimized sample timing  
-    int ret6b = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x1C, 0xF5); // Bidirectional + fast sample
+    int ret6b = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x1C, 0xF5); // Bidirectional + fast sample
     if (ret6b != 0) {
         LOG_WRN("Failed to set Control2: %d", ret6b);
     }
     
     // Control3: ERM open loop with supply compensation and stronger output
-    int ret6c = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x1D, 0xE0); // Max output + supply comp
+    int ret6c = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x1D, 0xE0); // Max output + supply comp
     if (ret6c != 0) {
         LOG_WRN("Failed to set enhanced Control3: %d", ret6c);
     }
@@ -213,6 +461,193 @@ int haptic_setup_external_trigger(drv2605_effect_t default_effect)
     }
 }
 
+/**
+ * @brief Queue an effect sequence - a refused one is only counted as dropped if count_drop is set
+ */
+static int haptic_sched_post(const haptic_step_t *steps, size_t step_count, haptic_priority_t priority,
+                             bool count_drop)
+{
+    if (!haptic_is_available() || !sched.started) {
+        return -ENODEV;
+    }
+    if (!steps || step_count == 0 || step_count > HAPTIC_MAX_STEPS) {
+        return -EINVAL;
+    }
+    
+    k_spinlock_key_t key = k_spin_lock(&sched.lock);
+    
+    // Compare against what plays next - a queued effect counts as playing
+    bool busy = sched.pending_count > 0 || sched.active;
+    haptic_priority_t current = sched.pending_count > 0 ? sched.pending_priority : sched.active_priority;
+    if (busy && priority < current) {
+        if (count_drop) {
+            sched.stats.dropped++;
+        }
+        k_spin_unlock(&sched.lock, key);
+        return -EBUSY;
+    }
+    
+    if (sched.pending_count > 0) {
+        sched.stats.preempted++;
+    }
+    memcpy(sched.pending_steps, steps, step_count * sizeof(haptic_step_t));
+    sched.pending_count = step_count;
+    sched.pending_priority = priority;
+    sched.stop_requested = false;
+    sched.active = true;
+    k_spin_unlock(&sched.lock, key);
+    
+    k_work_submit_to_queue(&sched.workq, &sched.request_work);
+    return 0;
+}
+
+/**
+ * @brief Queue an effect sequence on the haptic work queue
+ */
+int haptic_play_sequence(const haptic_step_t *steps, size_t step_count, haptic_priority_t priority)
+{
+    return haptic_sched_post(steps, step_count, priority, true);
+}
+
+/**
+ * @brief Queue count trigger pulses of on_us separated by off_us
+ */
+int haptic_play_pulses(uint8_t count, uint32_t on_us, uint32_t off_us, haptic_priority_t priority)
+{
+    haptic_step_t steps[HAPTIC_MAX_STEPS];
+    size_t n = 0;
+    
+    if (count == 0 || count * 2 - 1 > HAPTIC_MAX_STEPS) {
+        return -EINVAL;
+    }
+    
+    for (uint8_t i = 0; i < count; i++) {
+        if (i > 0) {
+            steps[n++] = (haptic_step_t)HAPTIC_STEP_PAUSE_US(off_us);
+        }
+        steps[n++] = (haptic_step_t)HAPTIC_STEP_PULSE_US(on_us);
+    }
+    
+    return haptic_play_sequence(steps, n, priority);
+}
+
+/**
+ * @brief Stop queued and playing effects up to max_priority, higher ones keep playing
+ */
+static void haptic_sched_cancel(haptic_priority_t max_priority)
+{
+    if (!sched.started) {
+        return;
+    }
+    
+    k_spinlock_key_t key = k_spin_lock(&sched.lock);
+    bool cancel = sched.pending_count > 0 ? sched.pending_priority <= max_priority
+                                          : sched.active && sched.active_priority <= max_priority;
+    if (cancel) {
+        sched.pending_count = 0;
+        sched.stop_requested = true;
+    }
+    k_spin_unlock(&sched.lock, key);
+    
+    if (cancel) {
+        k_work_submit_to_queue(&sched.workq, &sched.request_work);
+    }
+}
+
+/**
+ * @brief Stop the playing effect and drop any queued one
+ */
+void haptic_stop(void)
+{
+    haptic_sched_cancel(HAPTIC_PRIORITY_ALERT);
+}
+
+/**
+ * @brief Stop like haptic_stop() and wait until the work queue has brought the motor to rest
+ *
+ * Must not be called from the haptic work queue itself.
+ */
+void haptic_stop_sync(void)
+{
+    struct k_work_sync sync;
+    
+    if (!sched.started) {
+        return;
+    }
+    
+    haptic_stop();
+    
+    // The request handler ends the playing step and restores the mode; nothing may follow it
+    k_work_flush(&sched.request_work, &sync);
+    k_work_cancel_delayable_sync(&sched.step_work, &sync);
+}
+
+/**
+ * @brief Drive the motor in real-time playback from a host rumble amplitude
+ */
+int haptic_rumble(uint8_t amplitude)
+{
+    static uint8_t last_level = 0;
+    static uint32_t last_post_ms = 0;
+    
+    if (!haptic_is_available()) {
+        return -ENODEV;
+    }
+    
+    // RTP input is signed by default (Control3 DATA_FORMAT_RTP = 0) - 0x7F is full scale
+    uint8_t level = amplitude >> 1;
+    uint32_t now = k_uptime_get_32();
+    
+    if (level == 0) {
+        if (last_level != 0) {
+            haptic_sched_cancel(HAPTIC_PRIORITY_AMBIENT);
+            last_level = 0;
+        }
+        return 0;
+    }
+    
+    if (level == last_level && (now - last_post_ms) < HAPTIC_RUMBLE_REFRESH_MS) {
+        return 0;
+    }
+    
+    // Refreshes arrive with every ACK - one refused under a FEEDBACK/ALERT effect isn't a lost effect,
+    // so it stays out of the dropped count
+    const haptic_step_t step = HAPTIC_STEP_RTP_US(level, HAPTIC_RUMBLE_HOLD_US);
+    int ret = haptic_sched_post(&step, 1, HAPTIC_PRIORITY_AMBIENT, false);
+    if (ret == 0) {
+        // A refused update leaves these alone so the next one retries
+        last_level = level;
+        last_post_ms = now;
+    }
+    return ret;
+}
+
+/**
+ * @brief Check if an effect is queued or playing
+ */
+bool haptic_is_playing(void)
+{
+    k_spinlock_key_t key = k_spin_lock(&sched.lock);
+    bool playing = sched.active;
+    k_spin_unlock(&sched.lock, key);
+    
+    return playing;
+}
+
+/**
+ * @brief Snapshot of the effect scheduler statistics
+ */
+void haptic_get_sched_stats(haptic_sched_stats_t *stats)
+{
+    if (!stats) {
+        return;
+    }
+    
+    k_spinlock_key_t key = k_spin_lock(&sched.lock);
+    *stats = sched.stats;
+    k_spin_unlock(&sched.lock, key);
+}
+
 /**
  * @brief Send a pulse via external trigger
  */
@@ -222,13 +657,8 @@ int haptic_trigger_pulse(void)
         return -ENODEV;
     }
     
-    // Send pulse on trigger pin
-    gpio_pin_set_dt(haptic_ctx.trigger_pin, 1);  // Rising edge
-    k_sleep(K_USEC(100));                        // Short pulse width (100µs)
-    gpio_pin_set_dt(haptic_ctx.trigger_pin, 0);  // Falling edge
-    
-    LOG_DBG("External trigger pulse sent");
-    return 0;
+    // Short pulse width (100µs) - the rising edge starts the loaded waveform
+    return haptic_play_pulses(1, 100, 0, HAPTIC_PRIORITY_FEEDBACK);
 }
 
 /**
@@ -250,17 +680,17 @@ int haptic_play_pattern(haptic_pattern_t pattern)
                 return haptic_play_effect(DRV2605_EFFECT_SHARP_CLICK_100);
             }
             
-        case HAPTIC_PATTERN_STARTUP:
+        case HAPTIC_PATTERN_STARTUP: {
             // Double pulse for startup
             if (haptic_ctx.external_trigger_mode) {
-                haptic_trigger_pulse();
-                k_sleep(K_MSEC(100));
-                return haptic_trigger_pulse();
-            } else {
-                haptic_play_effect(DRV2605_EFFECT_SOFT_BUMP_30);
-                k_sleep(K_MSEC(200));
-                return haptic_play_effect(DRV2605_EFFECT_SOFT_BUMP_30);
+                return haptic_play_pulses(2, 100, 100000, HAPTIC_PRIORITY_ALERT);
             }
+            const haptic_step_t steps[] = {
+                HAPTIC_STEP_WAVEFORM_US(200000, DRV2605_EFFECT_SOFT_BUMP_30),
+                HAPTIC_STEP_WAVEFORM_US(0, DRV2605_EFFECT_SOFT_BUMP_30)
+            };
+            return haptic_play_sequence(steps, ARRAY_SIZE(steps), HAPTIC_PRIORITY_ALERT);
+        }
             
         case HAPTIC_PATTERN_NOTIFICATION_LIGHT:
             return haptic_play_effect(DRV2605_EFFECT_SOFT_BUMP_30);
@@ -271,13 +701,15 @@ int haptic_play_pattern(haptic_pattern_t pattern)
         case HAPTIC_PATTERN_NOTIFICATION_STRONG:
             return haptic_play_effect(DRV2605_EFFECT_SHARP_CLICK_100);
             
-        case HAPTIC_PATTERN_ERROR:
+        case HAPTIC_PATTERN_ERROR: {
             // Triple pulse for error
-            haptic_play_effect(DRV2605_EFFECT_SHARP_CLICK_100);
-            k_sleep(K_MSEC(100));
-            haptic_play_effect(DRV2605_EFFECT_SHARP_CLICK_100);
-            k_sleep(K_MSEC(100));
-            return haptic_play_effect(DRV2605_EFFECT_SHARP_CLICK_100);
+            const haptic_step_t steps[] = {
+                HAPTIC_STEP_WAVEFORM_US(100000, DRV2605_EFFECT_SHARP_CLICK_100),
+                HAPTIC_STEP_WAVEFORM_US(100000, DRV2605_EFFECT_SHARP_CLICK_100),
+                HAPTIC_STEP_WAVEFORM_US(0, DRV2605_EFFECT_SHARP_CLICK_100)
+            };
+            return haptic_play_sequence(steps, ARRAY_SIZE(steps), HAPTIC_PRIORITY_ALERT);
+        }
             
         case HAPTIC_PATTERN_SUCCESS:
             return haptic_play_effect(DRV2605_EFFECT_TRANSITION_RAMP_UP_LONG_SMOOTH_1);
@@ -299,24 +731,8 @@ int haptic_play_effect(drv2605_effect_t effect)
     
     LOG_DBG("Playing DRV2605 effect: %d", effect);
     
-    // Exit standby mode
-    int ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x01, 0x00);
-    if (ret != 0) return ret;
-    k_sleep(K_MSEC(1));
-    
-    // Set waveform
-    ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x04, effect);
-    if (ret != 0) return ret;
-    
-    // End sequence
-    ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x05, 0x00);
-    if (ret != 0) return ret;
-    
-    // Trigger playback
-    ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x0C, 0x01);
-    if (ret != 0) return ret;
-    
-    return 0;
+    const haptic_step_t step = HAPTIC_STEP_WAVEFORM_US(0, effect);
+    return haptic_play_sequence(&step, 1, HAPTIC_PRIORITY_FEEDBACK);
 }
 
 /**
@@ -331,7 +747,7 @@ int haptic_set_trigger_effect(drv2605_effect_t new_effect)
     LOG_INF("Changing trigger effect from %d to %d", haptic_ctx.current_effect, new_effect);
     
     // Update the waveform in slot 0
-    int ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x04, new_effect);
+    int ret = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x04, new_effect);
     if (ret == 0) {
         haptic_ctx.current_effect = new_effect;
         LOG_INF("Trigger effect updated successfully");
@@ -354,6 +770,8 @@ int haptic_enter_standby(void)
     
     LOG_INF("Entering haptic standby mode using enable pin");
     
+    haptic_stop_sync();
+    
     // Use the hardware enable pin to put the DRV2605 into standby
     // This is much safer than I2C communication during system shutdown
     return haptic_disable();
@@ -427,7 +845,8 @@ int haptic_get_debug_info(char *buffer, size_t buffer_size)
         "External Trigger: %s\n"
         "Current Effect: %d\n"
         "Trigger Pin: P%s.%02d\n"
-        "Enable Pin: P%s.%02d\n",
+        "Enable Pin: P%s.%02d\n"
+        "Effects: played=%u preempted=%u dropped=%u\n",
         haptic_ctx.status,
         haptic_ctx.i2c_dev,
         haptic_ctx.external_trigger_mode ? "YES" : "NO",
@@ -435,7 +854,8 @@ int haptic_get_debug_info(char *buffer, size_t buffer_size)
         haptic_ctx.trigger_pin ? haptic_ctx.trigger_pin->port->name : "NULL",
         haptic_ctx.trigger_pin ? haptic_ctx.trigger_pin->pin : 0,
         haptic_ctx.enable_pin ? haptic_ctx.enable_pin->port->name : "NULL",
-        haptic_ctx.enable_pin ? haptic_ctx.enable_pin->pin : 0);
+        haptic_ctx.enable_pin ? haptic_ctx.enable_pin->pin : 0,
+        sched.stats.played, sched.stats.preempted, sched.stats.dropped);
 }
 
 /**
@@ -530,7 +950,7 @@ int haptic_perform_erm_calibration(void)
     
     // Step 1: Exit standby mode
     printk("*** HAPTIC: Setting auto-calibration mode\n");
-    int ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x01, 0x07); // Auto-calibration mode
+    int ret = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x01, 0x07); // Auto-calibration mode
     if (ret != 0) {
         printk("*** HAPTIC: Failed to set auto-cal mode: %d\n", ret);
         return ret;
@@ -539,7 +959,7 @@ int haptic_perform_erm_calibration(void)
     
     // Step 2: Configure feedback control for ERM
     printk("*** HAPTIC: Configuring ERM feedback control\n");
-    ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x1A, 0x36); // ERM mode, BEMF gain=1x
+    ret = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x1A, 0x36); // ERM mode, BEMF gain=1x
     if (ret != 0) {
         printk("*** HAPTIC: Failed to set ERM mode: %d\n", ret);
         return ret;
@@ -547,7 +967,7 @@ int haptic_perform_erm_calibration(void)
     
     // Step 3: Set rated voltage for stronger ERM motor (~3.5V)
     printk("*** HAPTIC: Setting rated voltage\n");
-    ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x16, 0x4A); // ~3.5V rated voltage (higher)
+    ret = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x16, 0x4A); // ~3.5V rated voltage (higher)
     if (ret != 0) {
         printk("*** HAPTIC: Failed to set rated voltage: %d\n", ret);
         return ret;
@@ -555,7 +975,7 @@ int haptic_perform_erm_calibration(void)
     
     // Step 4: Set overdrive clamp voltage (~4.5V)
     printk("*** HAPTIC: Setting overdrive clamp\n");
-    ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x17, 0x9A); // ~4.5V overdrive clamp (higher)
+    ret = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x17, 0x9A); // ~4.5V overdrive clamp (higher)
     if (ret != 0) {
         printk("*** HAPTIC: Failed to set overdrive clamp: %d\n", ret);
         return ret;
@@ -563,7 +983,7 @@ int haptic_perform_erm_calibration(void)
     
     // Step 5: Start auto-calibration
     printk("*** HAPTIC: Starting calibration sequence\n");
-    ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x0C, 0x01); // GO bit
+    ret = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x0C, 0x01); // GO bit
     if (ret != 0) {
         printk("*** HAPTIC: Failed to start calibration: %d\n", ret);
         return ret;
@@ -576,7 +996,7 @@ int haptic_perform_erm_calibration(void)
     uint8_t go_reg = 0;
     
     while ((k_uptime_get_32() - start_time) < 3000) { // 3 second timeout
-        ret = i2c_reg_read_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x0C, &go_reg);
+        ret = i2c_bus_reg_read_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x0C, &go_reg);
         if (ret != 0) {
             printk("*** HAPTIC: Failed to read GO register: %d\n", ret);
             return ret;
@@ -602,7 +1022,7 @@ int haptic_perform_erm_calibration(void)
     
     // Read calibration results from status register
     uint8_t status_reg = 0;
-    ret = i2c_reg_read_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x00, &status_reg);
+    ret = i2c_bus_reg_read_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x00, &status_reg);
     if (ret == 0) {
         printk("*** HAPTIC: Status register: 0x%02X\n", status_reg);
         if (status_reg & 0x08) {
@@ -613,11 +1033,11 @@ int haptic_perform_erm_calibration(void)
         
         // Read compensation result and back-EMF
         uint8_t comp_result = 0, back_emf = 0;
-        ret = i2c_reg_read_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x18, &comp_result);
+        ret = i2c_bus_reg_read_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x18, &comp_result);
         if (ret == 0) {
             printk("*** HAPTIC: Compensation result: 0x%02X\n", comp_result);
         }
-        ret = i2c_reg_read_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x19, &back_emf);
+        ret = i2c_bus_reg_read_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x19, &back_emf);
         if (ret == 0) {
             printk("*** HAPTIC: Back-EMF result: 0x%02X\n", back_emf);
         }
@@ -632,7 +1052,7 @@ int haptic_perform_erm_calibration(void)
     
     // Return to standby mode - let haptic_setup_external_trigger handle final config
     printk("*** HAPTIC: Returning to standby mode\n");
-    ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x01, 0x40); // Standby mode
+    ret = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x01, 0x40); // Standby mode
     
     printk("*** HAPTIC: ERM auto-calibration process complete - ready for external trigger setup\n");
     return 0;
@@ -651,7 +1071,7 @@ int haptic_perform_lra_calibration(void)
 
     // Step 1: Exit standby mode and set auto-calibration mode
     printk("*** HAPTIC: Setting auto-calibration mode\n");
-    int ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x01, 0x07); // Auto-calibration mode
+    int ret = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x01, 0x07); // Auto-calibration mode
     if (ret != 0) {
         printk("*** HAPTIC: Failed to set auto-cal mode: %d\n", ret);
         return ret;
@@ -660,7 +1080,7 @@ int haptic_perform_lra_calibration(void)
 
     // Step 2: Configure feedback control for LRA
     printk("*** HAPTIC: Configuring LRA feedback control\n");
-    ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x1A, 0xB6); // LRA mode, BEMF gain=1x
+    ret = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x1A, 0xB6); // LRA mode, BEMF gain=1x
     if (ret != 0) {
         printk("*** HAPTIC: Failed to set LRA mode: %d\n", ret);
         return ret;
@@ -668,7 +1088,7 @@ int haptic_perform_lra_calibration(void)
 
     // Step 3: Set LRA library 
     printk("*** HAPTIC: Setting LRA library\n");
-    ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x03, 0x06); // LRA Library
+    ret = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x03, 0x06); // LRA Library
     if (ret != 0) {
         printk("*** HAPTIC: Failed to set LRA library: %d\n", ret);
         return ret;
@@ -676,7 +1096,7 @@ int haptic_perform_lra_calibration(void)
 
     // Step 4: Set rated voltage for LRA motor (~2.0V typical for LRA)
     printk("*** HAPTIC: Setting LRA rated voltage\n");
-    ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x16, 0x3E); // ~2.0V rated voltage
+    ret = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x16, 0x3E); // ~2.0V rated voltage
     if (ret != 0) {
         printk("*** HAPTIC: Failed to set rated voltage: %d\n", ret);
         return ret;
@@ -684,7 +1104,7 @@ int haptic_perform_lra_calibration(void)
 
     // Step 5: Set overdrive clamp voltage (~2.5V for LRA)
     printk("*** HAPTIC: Setting LRA overdrive clamp\n");
-    ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x17, 0x6C); // ~2.5V overdrive clamp
+    ret = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x17, 0x6C); // ~2.5V overdrive clamp
     if (ret != 0) {
         printk("*** HAPTIC: Failed to set overdrive clamp: %d\n", ret);
         return ret;
@@ -692,7 +1112,7 @@ int haptic_perform_lra_calibration(void)
 
     // Step 6: Start auto-calibration
     printk("*** HAPTIC: Starting LRA calibration sequence\n");
-    ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x0C, 0x01); // GO bit
+    ret = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x0C, 0x01); // GO bit
     if (ret != 0) {
         printk("*** HAPTIC: Failed to start calibration: %d\n", ret);
         return ret;
@@ -706,7 +1126,7 @@ int haptic_perform_lra_calibration(void)
 
     while ((k_uptime_get_32() - start_time) < timeout_ms) {
         uint8_t go_bit = 0;
-        ret = i2c_reg_read_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x0C, &go_bit);
+        ret = i2c_bus_reg_read_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x0C, &go_bit);
         if (ret == 0 && (go_bit & 0x01) == 0) {
             calibration_complete = true;
             printk("*** HAPTIC: LRA calibration completed in %ums\n", 
@@ -723,7 +1143,7 @@ int haptic_perform_lra_calibration(void)
 
     // Step 8: Check calibration results
     uint8_t diag_result = 0;
-    ret = i2c_reg_read_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x00, &diag_result);
+    ret = i2c_bus_reg_read_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x00, &diag_result);
     if (ret == 0) {
         if (diag_result & 0x08) { // DIAG_RESULT bit
             printk("*** HAPTIC: LRA auto-calibration successful - motor optimized\n");
@@ -733,11 +1153,11 @@ int haptic_perform_lra_calibration(void)
 
         // Read LRA resonance frequency and impedance results
         uint8_t lra_period = 0, lra_impedance = 0;
-        ret = i2c_reg_read_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x20, &lra_period);
+        ret = i2c_bus_reg_read_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x20, &lra_period);
         if (ret == 0) {
             printk("*** HAPTIC: LRA Period result: 0x%02X\n", lra_period);
         }
-        ret = i2c_reg_read_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x21, &lra_impedance);
+        ret = i2c_bus_reg_read_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x21, &lra_impedance);
         if (ret == 0) {
             printk("*** HAPTIC: LRA Impedance result: 0x%02X\n", lra_impedance);
         }
@@ -751,7 +1171,7 @@ int haptic_perform_lra_calibration(void)
 
     // Return to standby mode - let haptic_setup_external_trigger handle final config
     printk("*** HAPTIC: Returning to standby mode\n");
-    ret = i2c_reg_write_byte(haptic_ctx.i2c_dev, DRV2605_I2C_ADDR, 0x01, 0x40); // Standby mode
+    ret = i2c_bus_reg_write_byte(I2C_BUS_CLIENT_HAPTICS, DRV2605_I2C_ADDR, 0x01, 0x40); // Standby mode
 
     printk("*** HAPTIC: LRA auto-calibration process complete - ready for external trigger setup\n");
     return 0;
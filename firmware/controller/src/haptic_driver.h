@@ -42,6 +42,59 @@ typedef enum {
     HAPTIC_PATTERN_CUSTOM
 } haptic_pattern_t;
 
+// Effect scheduler - sequences play on a dedicated work queue, callers never block
+#define HAPTIC_MAX_STEPS            16      // Steps per effect sequence
+#define HAPTIC_WAVEFORM_SLOTS       8       // DRV2605 waveform sequencer registers 0x04-0x0B
+#define HAPTIC_WORKQ_STACK_SIZE     1024
+#define HAPTIC_WORKQ_PRIORITY       7       // Below trackpad (5) and display (6), above the IMU reader (8)
+
+// Host rumble - one RTP step per update, held so a lost link fades the motor out on its own
+#define HAPTIC_RUMBLE_HOLD_US       20000   // Motor stops this long after the last update
+#define HAPTIC_RUMBLE_REFRESH_MS    10      // Re-post an unchanged level this often to keep it held
+
+/**
+ * @brief Effect sequence step types
+ */
+typedef enum {
+    HAPTIC_STEP_PULSE = 0,          // Trigger pin high for duration_us - plays the loaded trigger effect
+    HAPTIC_STEP_WAVEFORM,           // Load the waveform slots and GO over I2C, lasts until GO clears (at least duration_us)
+    HAPTIC_STEP_RTP,                // Real-time playback at level for duration_us
+    HAPTIC_STEP_PAUSE               // Motor idle for duration_us
+} haptic_step_type_t;
+
+/**
+ * @brief One timed step of an effect sequence
+ */
+typedef struct {
+    haptic_step_type_t type;
+    uint32_t duration_us;
+    uint8_t level;                              // RTP amplitude (signed format: 0x00 off, 0x7F full)
+    uint8_t waveforms[HAPTIC_WAVEFORM_SLOTS];   // Library effects, a 0 ends the sequence early
+} haptic_step_t;
+
+#define HAPTIC_STEP_PULSE_US(us)            { .type = HAPTIC_STEP_PULSE, .duration_us = (us) }
+#define HAPTIC_STEP_PAUSE_US(us)            { .type = HAPTIC_STEP_PAUSE, .duration_us = (us) }
+#define HAPTIC_STEP_RTP_US(lvl, us)         { .type = HAPTIC_STEP_RTP, .duration_us = (us), .level = (lvl) }
+#define HAPTIC_STEP_WAVEFORM_US(us, ...)    { .type = HAPTIC_STEP_WAVEFORM, .duration_us = (us), .waveforms = { __VA_ARGS__ } }
+
+/**
+ * @brief Effect priorities - a new effect replaces a playing one of the same or lower priority, otherwise it is dropped
+ */
+typedef enum {
+    HAPTIC_PRIORITY_AMBIENT = 0,    // Continuous effects (host rumble), any feedback may cut in
+    HAPTIC_PRIORITY_FEEDBACK,       // Clicks and detents
+    HAPTIC_PRIORITY_ALERT           // System confirmations (calibration, sleep) - never cut by feedback
+} haptic_priority_t;
+
+/**
+ * @brief Effect scheduler statistics
+ */
+typedef struct {
+    uint32_t played;                // Effects that ran to completion
+    uint32_t preempted;             // Effects cut short by a newer one
+    uint32_t dropped;               // Requests refused for lower priority (rumble refreshes excluded)
+} haptic_sched_stats_t;
+
 /**
  * @brief Haptic driver context structure
  */
@@ -91,14 +144,66 @@ int haptic_setup_external_trigger(drv2605_effect_t default_effect);
 /**
  * @brief Send a pulse via external trigger
  * 
- * This triggers the currently loaded waveform via GPIO pulse
+ * This triggers the currently loaded waveform via GPIO pulse. The pulse is
+ * queued at feedback priority and the call returns immediately.
  * 
  * @return 0 on success, negative error code on failure
  */
 int haptic_trigger_pulse(void);
 
 /**
- * @brief Play a predefined haptic pattern
+ * @brief Queue an effect sequence on the haptic work queue
+ * 
+ * The steps are copied, so the array may live on the caller's stack. Returns
+ * immediately - the sequence plays in the background.
+ * 
+ * @param steps Sequence steps
+ * @param step_count Number of steps (1 to HAPTIC_MAX_STEPS)
+ * @param priority Preemption priority
+ * @return 0 when queued, -EBUSY if a higher priority effect is playing, negative error code on failure
+ */
+int haptic_play_sequence(const haptic_step_t *steps, size_t step_count, haptic_priority_t priority);
+
+/**
+ * @brief Queue count trigger pulses of on_us separated by off_us
+ * 
+ * @return 0 when queued, -EBUSY if a higher priority effect is playing, negative error code on failure
+ */
+int haptic_play_pulses(uint8_t count, uint32_t on_us, uint32_t off_us, haptic_priority_t priority);
+
+/**
+ * @brief Stop the playing effect and drop any queued one
+ */
+void haptic_stop(void);
+
+/**
+ * @brief Stop the playing effect and wait until the motor is no longer driven
+ */
+void haptic_stop_sync(void);
+
+/**
+ * @brief Drive the motor in real-time playback from a host rumble amplitude
+ * 
+ * Call on every update (ISR safe). Consecutive levels continue the same RTP
+ * drive without gaps; clicks and alerts cut in and rumble resumes after them.
+ * 
+ * @param amplitude Host motor amplitude (0 = off, 255 = full)
+ * @return 0 when applied or unchanged, -EBUSY while a higher priority effect plays, negative error code on failure
+ */
+int haptic_rumble(uint8_t amplitude);
+
+/**
+ * @brief Check if an effect is queued or playing
+ */
+bool haptic_is_playing(void);
+
+/**
+ * @brief Snapshot of the effect scheduler statistics
+ */
+void haptic_get_sched_stats(haptic_sched_stats_t *stats);
+
+/**
+ * @brief Play a predefined haptic pattern without blocking
  * 
  * @param pattern Pattern to play
  * @return 0 on success, negative error code on failure
@@ -106,7 +211,7 @@ int haptic_trigger_pulse(void);
 int haptic_play_pattern(haptic_pattern_t pattern);
 
 /**
- * @brief Play a specific DRV2605 effect via I2C
+ * @brief Play a specific DRV2605 effect via I2C without blocking
  * 
  * @param effect DRV2605 effect to play
  * @return 0 on success, negative error code on failure
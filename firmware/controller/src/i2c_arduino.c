@@ -1,6 +1,9 @@
 #include "i2c_arduino.h"
+#include "i2c_bus_driver.h"
 #include <string.h>
 
+// Only the IQS7211E driver uses this shim, so its transfers are trackpad bus requests
+
 void wire_begin(ArduinoI2C *wire, const struct device *i2c_dev) {
     wire->i2c_dev = i2c_dev;
     wire->length = 0;
@@ -26,7 +29,7 @@ int wire_write_buffer(ArduinoI2C *wire, const uint8_t *data, size_t len) {
 }
 
 int wire_endTransmission(ArduinoI2C *wire) {
-    int ret = i2c_write(wire->i2c_dev, wire->buffer, wire->length, wire->address);
+    int ret = i2c_bus_write(I2C_BUS_CLIENT_TRACKPAD, wire->buffer, wire->length, wire->address);
     wire->length = 0;
     return ret;
 }
@@ -35,7 +38,7 @@ int wire_endTransmission_stop(ArduinoI2C *wire, bool stop) {
     // In Zephyr I2C, we always do a complete transaction
     // The stop parameter doesn't affect the actual I2C transaction in our implementation
     // but we maintain compatibility with Arduino Wire library
-    int ret = i2c_write(wire->i2c_dev, wire->buffer, wire->length, wire->address);
+    int ret = i2c_bus_write(I2C_BUS_CLIENT_TRACKPAD, wire->buffer, wire->length, wire->address);
     wire->length = 0;
     return ret;
 }
@@ -43,7 +46,7 @@ int wire_endTransmission_stop(ArduinoI2C *wire, bool stop) {
 int wire_requestFrom(ArduinoI2C *wire, uint16_t address, size_t length) {
     if (length > I2C_BUFFER_MAX) return -ENOMEM;
     wire->address = address;
-    int ret = i2c_read(wire->i2c_dev, wire->buffer, length, address);
+    int ret = i2c_bus_read(I2C_BUS_CLIENT_TRACKPAD, wire->buffer, length, address);
     if (ret == 0) {
         wire->length = length;
     } else {
@@ -0,0 +1,248 @@
+/**
+ ******************************************************************************
+ * @file    i2c_bus_driver.c
+ * @brief   Prioritized transaction scheduler for the shared i2c1 bus
+ * @author  Controller Team
+ * @version V1.0
+ * @date    2025
+ ******************************************************************************
+ */
+
+#include "i2c_bus_driver.h"
+#include <zephyr/logging/log.h>
+#include <string.h>
+
+LOG_MODULE_REGISTER(i2c_bus, LOG_LEVEL_ERR);
+
+// Bus scheduler context
+typedef struct
+{
+    const struct device *i2c_dev;
+    bool initialized;
+
+    // Ownership - a releasing client hands the bus straight to the next one, it never goes idle in between
+    struct k_spinlock lock;
+    bool busy;
+    i2c_bus_client_t owner;
+    uint32_t grant_cycles;                          // When the owner got the bus
+    uint8_t waiting[I2C_BUS_CLIENT_COUNT];          // Pending requests per client
+    struct k_sem grant_sem[I2C_BUS_CLIENT_COUNT];   // Given once per grant to a waiting client
+
+    i2c_bus_client_stats_t stats[I2C_BUS_CLIENT_COUNT];
+} i2c_bus_context_t;
+
+static i2c_bus_context_t g_bus_ctx;
+
+/**
+ * @brief Record a grant to client - caller holds the lock
+ */
+static void i2c_bus_grant_locked(i2c_bus_client_t client, uint32_t request_cycles, uint32_t now)
+{
+    i2c_bus_client_stats_t *stats = &g_bus_ctx.stats[client];
+    uint32_t wait_us = k_cyc_to_us_floor32(now - request_cycles);
+
+    g_bus_ctx.busy = true;
+    g_bus_ctx.owner = client;
+    g_bus_ctx.grant_cycles = now;
+
+    stats->wait_us += wait_us;
+    stats->wait_max_us = MAX(stats->wait_max_us, wait_us);
+}
+
+int i2c_bus_init(void)
+{
+    g_bus_ctx.i2c_dev = DEVICE_DT_GET(DT_NODELABEL(i2c1));
+    if (!device_is_ready(g_bus_ctx.i2c_dev))
+    {
+        LOG_ERR("i2c1 not ready");
+        return -ENODEV;
+    }
+
+    for (int i = 0; i < I2C_BUS_CLIENT_COUNT; i++)
+    {
+        k_sem_init(&g_bus_ctx.grant_sem[i], 0, K_SEM_MAX_LIMIT);
+        g_bus_ctx.waiting[i] = 0;
+    }
+    g_bus_ctx.busy = false;
+    memset(g_bus_ctx.stats, 0, sizeof(g_bus_ctx.stats));
+    g_bus_ctx.initialized = true;
+
+    return 0;
+}
+
+const struct device *i2c_bus_get_device(void)
+{
+    return g_bus_ctx.i2c_dev;
+}
+
+int i2c_bus_acquire(i2c_bus_client_t client, k_timeout_t timeout)
+{
+    if (!g_bus_ctx.initialized || client >= I2C_BUS_CLIENT_COUNT)
+    {
+        return -EINVAL;
+    }
+
+    uint32_t request_cycles = k_cycle_get_32();
+    k_spinlock_key_t key = k_spin_lock(&g_bus_ctx.lock);
+
+    if (!g_bus_ctx.busy)
+    {
+        i2c_bus_grant_locked(client, request_cycles, request_cycles);
+        k_spin_unlock(&g_bus_ctx.lock, key);
+        return 0;
+    }
+
+    g_bus_ctx.waiting[client]++;
+    k_spin_unlock(&g_bus_ctx.lock, key);
+
+    // The releasing client records the grant, we only pick it up
+    int ret = k_sem_take(&g_bus_ctx.grant_sem[client], timeout);
+    key = k_spin_lock(&g_bus_ctx.lock);
+    if (ret != 0)
+    {
+        // A grant may have landed between the timeout and taking the lock - release gives the
+        // semaphore under this lock, so it is already there and we own the bus
+        if (k_sem_take(&g_bus_ctx.grant_sem[client], K_NO_WAIT) == 0)
+        {
+            ret = 0;
+        }
+        else
+        {
+            g_bus_ctx.waiting[client]--;
+            g_bus_ctx.stats[client].timeouts++;
+        }
+    }
+    if (ret == 0)
+    {
+        // Wait time runs from the request to the hand-over
+        i2c_bus_client_stats_t *stats = &g_bus_ctx.stats[client];
+        uint32_t wait_us = k_cyc_to_us_floor32(g_bus_ctx.grant_cycles - request_cycles);
+        stats->wait_us += wait_us;
+        stats->wait_max_us = MAX(stats->wait_max_us, wait_us);
+    }
+    k_spin_unlock(&g_bus_ctx.lock, key);
+
+    return ret == 0 ? 0 : -EBUSY;
+}
+
+void i2c_bus_release(i2c_bus_client_t client)
+{
+    uint32_t now = k_cycle_get_32();
+    int next = -1;
+
+    k_spinlock_key_t key = k_spin_lock(&g_bus_ctx.lock);
+
+    if (!g_bus_ctx.busy || g_bus_ctx.owner != client)
+    {
+        k_spin_unlock(&g_bus_ctx.lock, key);
+        LOG_ERR("Client %d released a bus it does not own", client);
+        return;
+    }
+
+    i2c_bus_client_stats_t *stats = &g_bus_ctx.stats[client];
+    uint32_t busy_us = k_cyc_to_us_floor32(now - g_bus_ctx.grant_cycles);
+    stats->transactions++;
+    stats->busy_us += busy_us;
+    stats->busy_max_us = MAX(stats->busy_max_us, busy_us);
+
+    // Highest priority waiter wins, the others keep waiting
+    for (int i = 0; i < I2C_BUS_CLIENT_COUNT; i++)
+    {
+        if (g_bus_ctx.waiting[i] == 0)
+        {
+            continue;
+        }
+        if (next < 0)
+        {
+            next = i;
+        }
+        else
+        {
+            g_bus_ctx.stats[next].preemptions++;
+            break;
+        }
+    }
+
+    if (next >= 0)
+    {
+        // Give under the lock so a waiter timing out sees the grant and its semaphore together
+        g_bus_ctx.waiting[next]--;
+        g_bus_ctx.owner = (i2c_bus_client_t)next;
+        g_bus_ctx.grant_cycles = now;
+        k_sem_give(&g_bus_ctx.grant_sem[next]);
+    }
+    else
+    {
+        g_bus_ctx.busy = false;
+    }
+    k_spin_unlock(&g_bus_ctx.lock, key);
+}
+
+int i2c_bus_write(i2c_bus_client_t client, const uint8_t *buf, uint32_t num_bytes, uint16_t addr)
+{
+    int ret = i2c_bus_acquire(client, K_MSEC(I2C_BUS_ACQUIRE_TIMEOUT_MS));
+    if (ret != 0)
+    {
+        return ret;
+    }
+    ret = i2c_write(g_bus_ctx.i2c_dev, buf, num_bytes, addr);
+    i2c_bus_release(client);
+    return ret;
+}
+
+int i2c_bus_read(i2c_bus_client_t client, uint8_t *buf, uint32_t num_bytes, uint16_t addr)
+{
+    int ret = i2c_bus_acquire(client, K_MSEC(I2C_BUS_ACQUIRE_TIMEOUT_MS));
+    if (ret != 0)
+    {
+        return ret;
+    }
+    ret = i2c_read(g_bus_ctx.i2c_dev, buf, num_bytes, addr);
+    i2c_bus_release(client);
+    return ret;
+}
+
+int i2c_bus_write_read(i2c_bus_client_t client, uint16_t addr,
+                       const void *write_buf, size_t num_write,
+                       void *read_buf, size_t num_read)
+{
+    int ret = i2c_bus_acquire(client, K_MSEC(I2C_BUS_ACQUIRE_TIMEOUT_MS));
+    if (ret != 0)
+    {
+        return ret;
+    }
+    ret = i2c_write_read(g_bus_ctx.i2c_dev, addr, write_buf, num_write, read_buf, num_read);
+    i2c_bus_release(client);
+    return ret;
+}
+
+int i2c_bus_reg_read_byte(i2c_bus_client_t client, uint16_t addr, uint8_t reg, uint8_t *value)
+{
+    return i2c_bus_write_read(client, addr, &reg, 1, value, 1);
+}
+
+int i2c_bus_reg_write_byte(i2c_bus_client_t client, uint16_t addr, uint8_t reg, uint8_t value)
+{
+    uint8_t buf[2] = {reg, value};
+
+    return i2c_bus_write(client, buf, sizeof(buf), addr);
+}
+
+void i2c_bus_get_stats(i2c_bus_client_t client, i2c_bus_client_stats_t *stats)
+{
+    if (client >= I2C_BUS_CLIENT_COUNT || !stats)
+    {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&g_bus_ctx.lock);
+    *stats = g_bus_ctx.stats[client];
+    k_spin_unlock(&g_bus_ctx.lock, key);
+}
+
+void i2c_bus_reset_stats(void)
+{
+    k_spinlock_key_t key = k_spin_lock(&g_bus_ctx.lock);
+    memset(g_bus_ctx.stats, 0, sizeof(g_bus_ctx.stats));
+    k_spin_unlock(&g_bus_ctx.lock, key);
+}
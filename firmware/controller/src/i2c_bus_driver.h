@@ -0,0 +1,96 @@
+/**
+ ******************************************************************************
+ * @file    i2c_bus_driver.h
+ * @brief   Prioritized transaction scheduler for the shared i2c1 bus
+ * @author  Controller Team
+ * @version V1.0
+ * @date    2025
+ ******************************************************************************
+ * @attention
+ *
+ * The trackpad, the SSD1306 display and the DRV2605 haptic driver share
+ * i2c1. Every transaction on that bus goes through this driver: while the
+ * bus is busy, requests wait and the next grant goes to the highest priority
+ * client waiting. Long transfers (display frames) are split by their owner
+ * into short chunks so a trackpad read never waits for a whole frame.
+ *
+ ******************************************************************************
+ */
+
+#ifndef I2C_BUS_DRIVER_H
+#define I2C_BUS_DRIVER_H
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/i2c.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define I2C_BUS_ACQUIRE_TIMEOUT_MS  100     // Matches CONFIG_I2C_NRFX_TRANSFER_TIMEOUT - a stuck bus must not freeze a thread
+
+// Bus clients in priority order - a lower value is granted first
+typedef enum {
+    I2C_BUS_CLIENT_TRACKPAD = 0,    // RDY-driven reads, latency critical
+    I2C_BUS_CLIENT_HAPTICS,         // Effect triggers, short writes
+    I2C_BUS_CLIENT_DISPLAY,         // Frame chunks, background
+    I2C_BUS_CLIENT_COUNT
+} i2c_bus_client_t;
+
+// Per-client bus statistics
+typedef struct {
+    uint32_t transactions;          // Completed bus grants
+    uint32_t busy_us;               // Total time holding the bus
+    uint32_t busy_max_us;           // Longest single hold
+    uint32_t wait_us;               // Total time waiting for a grant
+    uint32_t wait_max_us;           // Longest single wait
+    uint32_t preemptions;           // Grants handed over ahead of a waiting lower priority client
+    uint32_t timeouts;              // Requests that gave up waiting
+} i2c_bus_client_stats_t;
+
+/**
+ * @brief Initialize the bus scheduler - call before any i2c1 client is used
+ * @return 0 on success, -ENODEV if i2c1 is not ready
+ */
+int i2c_bus_init(void);
+
+/**
+ * @brief The i2c1 device managed by the scheduler
+ */
+const struct device *i2c_bus_get_device(void);
+
+/**
+ * @brief Wait for exclusive use of the bus
+ *
+ * Use around transfers that go through another driver (e.g. display_write),
+ * keep each hold short. Not callable from ISRs.
+ *
+ * @param client Requesting client, decides the grant order
+ * @param timeout Maximum time to wait for the grant
+ * @return 0 when granted, -EBUSY on timeout
+ */
+int i2c_bus_acquire(i2c_bus_client_t client, k_timeout_t timeout);
+
+/**
+ * @brief Release the bus and hand it to the highest priority waiting client
+ */
+void i2c_bus_release(i2c_bus_client_t client);
+
+// Single transactions - acquire, transfer, release. Same arguments and returns as the Zephyr i2c API.
+int i2c_bus_write(i2c_bus_client_t client, const uint8_t *buf, uint32_t num_bytes, uint16_t addr);
+int i2c_bus_read(i2c_bus_client_t client, uint8_t *buf, uint32_t num_bytes, uint16_t addr);
+int i2c_bus_write_read(i2c_bus_client_t client, uint16_t addr,
+                       const void *write_buf, size_t num_write,
+                       void *read_buf, size_t num_read);
+int i2c_bus_reg_read_byte(i2c_bus_client_t client, uint16_t addr, uint8_t reg, uint8_t *value);
+int i2c_bus_reg_write_byte(i2c_bus_client_t client, uint16_t addr, uint8_t reg, uint8_t value);
+
+/**
+ * @brief Snapshot of one client's bus statistics
+ */
+void i2c_bus_get_stats(i2c_bus_client_t client, i2c_bus_client_stats_t *stats);
+
+/**
+ * @brief Clear all bus statistics
+ */
+void i2c_bus_reset_stats(void);
+
+#endif // I2C_BUS_DRIVER_H
@@ -4,9 +4,48 @@
  */
 
 #include "imu_driver.h"
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/sys/byteorder.h>
+#include <stdlib.h>
 
 LOG_MODULE_REGISTER(imu_driver, LOG_LEVEL_ERR);
 
+// LSM6DSL FIFO registers - batching isn't exposed by the Zephyr sensor API, so it is driven directly
+#define LSM6DSL_REG_FIFO_CTRL1          0x06
+#define LSM6DSL_REG_FIFO_CTRL2          0x07
+#define LSM6DSL_REG_FIFO_CTRL3          0x08
+#define LSM6DSL_REG_FIFO_CTRL5          0x0A
+#define LSM6DSL_REG_INT1_CTRL           0x0D
+#define LSM6DSL_REG_CTRL1_XL            0x10
+#define LSM6DSL_REG_CTRL2_G             0x11
+#define LSM6DSL_REG_OUTX_L_G            0x22    // OUTX_L_G..OUTZ_H_XL: Gx Gy Gz XLx XLy XLz
+#define LSM6DSL_REG_FIFO_STATUS1        0x3A
+#define LSM6DSL_REG_FIFO_DATA_OUT_L     0x3E
+#define LSM6DSL_FIFO_CTRL3_NO_DEC       0x09    // Gyro + accel datasets, no decimation
+#define LSM6DSL_FIFO_MODE_BYPASS        0x00
+#define LSM6DSL_FIFO_MODE_CONTINUOUS    0x06
+#define LSM6DSL_FIFO_STATUS2_OVER_RUN   0x40
+#define LSM6DSL_FIFO_STATUS2_EMPTY      0x10
+#define LSM6DSL_FIFO_WORDS_PER_SAMPLE   6       // Pattern: Gx Gy Gz XLx XLy XLz
+#define LSM6DSL_FIFO_BYTES_PER_SAMPLE   (LSM6DSL_FIFO_WORDS_PER_SAMPLE * 2)
+#define LSM6DSL_INT1_FTH                0x08    // FIFO watermark on INT1
+#define LSM6DSL_FIFO_WATERMARK_WORDS    (IMU_FIFO_WATERMARK_SAMPLES * LSM6DSL_FIFO_WORDS_PER_SAMPLE)
+
+// Reader thread - lower priority than the radio loop, the 4 KB sensor FIFO absorbs any delay
+#define IMU_READER_STACK_SIZE   2048
+#define IMU_READER_PRIORITY     8
+#define IMU_IRQ_TIMEOUT_PERIODS 4       // Watermark periods to wait before polling anyway (missed edge)
+
+#define IMU_STANDARD_GRAVITY    9.80665f
+#define IMU_DEG_TO_RAD          0.017453293f
+
+// Online gyro bias estimation - a window counts as still when every axis stays this quiet
+#define IMU_BIAS_GYRO_STD_DPS   0.3f    // Gyro noise allowed per axis
+#define IMU_BIAS_ACCEL_STD_G    0.01f   // Accel noise allowed per axis (hand tremor is far above this)
+#define IMU_BIAS_MAX_DPS        10.0f   // LSM6DSL zero-rate level limit - larger means slow rotation
+#define IMU_BIAS_STILL_WINDOWS  2       // Consecutive still windows before the first update
+#define IMU_BIAS_EMA_SHIFT      3       // Each further still window moves the bias 1/8 of the way
+
 // Global IMU context
 static imu_context_t imu_ctx = {
     .sensor_dev = NULL,
@@ -20,16 +59,458 @@ static imu_context_t imu_ctx = {
     .error_count = 0
 };
 
+// FIFO watermark interrupt (INT1) - the Zephyr driver only claims it with LSM6DSL_TRIGGER
+#if DT_NODE_HAS_PROP(DT_NODELABEL(lsm6ds3tr_c), irq_gpios)
+static const struct gpio_dt_spec imu_int1 = GPIO_DT_SPEC_GET(DT_NODELABEL(lsm6ds3tr_c), irq_gpios);
+#else
+static const struct gpio_dt_spec imu_int1 = {0};
+#endif
+static struct gpio_callback imu_int1_cb;
+static bool imu_int1_cb_added;
+static K_SEM_DEFINE(imu_data_sem, 0, 1);
+
+// Online gyro bias estimator - only touched by the context that processes raw samples
+static struct {
+    int32_t sum[6];                 // Raw LSB sums over the current window (Gx Gy Gz XLx XLy XLz)
+    int64_t sum_sq[6];              // Raw LSB squared sums
+    uint16_t count;                 // Samples in the current window
+    uint8_t still_windows;          // Consecutive still windows
+    int64_t gyro_var_limit;         // Per-axis variance limits in LSB^2 * N^2
+    int64_t accel_var_limit;
+    int32_t gyro_mean_limit_q8;     // |mean| limit in LSB * 256
+} bias_est;
+
+// Samples published by the reader thread; head/tail live in imu_ctx
+static imu_timed_sample_t imu_sample_ring[IMU_SAMPLE_RING_SIZE];
+
+K_THREAD_STACK_DEFINE(imu_reader_stack, IMU_READER_STACK_SIZE);
+
 // Default configuration
 static const imu_config_t DEFAULT_CONFIG = {
-    .accel_odr = 104,               // 104 Hz
-    .gyro_odr = 104,                // 104 Hz  
-    .filter_alpha = 0.4f,           // Moderate filtering
+    .accel_odr = 416,               // 416 Hz - batched in FIFO, several samples per radio packet
+    .gyro_odr = 416,                // 416 Hz
+    .filter_alpha = 0.12f,          // Per-sample at 416 Hz = the old 0.4 per 104 Hz report: 1 - 0.6^(104/416)
     .auto_calibrate = false,        // Manual calibration
     .accel_scale_factor = 800.0f,   // Scale to controller range
-    .gyro_scale_factor = 1200.0f    // Scale to controller range
+    .gyro_scale_factor = 1200.0f,   // Scale to controller range
+    .use_fifo = true,               // Drain the hardware FIFO instead of polling one sample
+    .raw_mode = true,               // Integer LSB -> wire path, sensor_value/float only for debug
+    .online_gyro_bias = true        // Track gyro drift whenever the controller is set down
+};
+
+// Raw sample word order, shared by the output registers and the FIFO pattern
+enum {
+    IMU_RAW_GX = 0,
+    IMU_RAW_GY,
+    IMU_RAW_GZ,
+    IMU_RAW_XL_X,
+    IMU_RAW_XL_Y,
+    IMU_RAW_XL_Z,
+    IMU_RAW_AXES
 };
 
+/**
+ * @brief Run one sample through calibration and the low-pass filter
+ */
+static void imu_process_sample(double ax, double ay, double az, double gx, double gy, double gz)
+{
+    imu_ctx.raw_data.accel_x = ax;
+    imu_ctx.raw_data.accel_y = ay;
+    imu_ctx.raw_data.accel_z = az;
+    imu_ctx.raw_data.gyro_x = gx;
+    imu_ctx.raw_data.gyro_y = gy;
+    imu_ctx.raw_data.gyro_z = gz;
+    imu_ctx.raw_data.timestamp = k_uptime_get_32();
+    
+    // Apply calibration offsets
+    imu_ctx.raw_data.accel_x -= imu_ctx.calibration.accel_offset_x;
+    imu_ctx.raw_data.accel_y -= imu_ctx.calibration.accel_offset_y;
+    imu_ctx.raw_data.accel_z -= imu_ctx.calibration.accel_offset_z;
+    imu_ctx.raw_data.gyro_x -= imu_ctx.calibration.gyro_offset_x;
+    imu_ctx.raw_data.gyro_y -= imu_ctx.calibration.gyro_offset_y;
+    imu_ctx.raw_data.gyro_z -= imu_ctx.calibration.gyro_offset_z;
+    
+    // Apply low-pass filter
+    if (!imu_ctx.filtered_data.filter_initialized) {
+        // Initialize filter with first reading
+        imu_ctx.filtered_data.accel_x = imu_ctx.raw_data.accel_x;
+        imu_ctx.filtered_data.accel_y = imu_ctx.raw_data.accel_y;
+        imu_ctx.filtered_data.accel_z = imu_ctx.raw_data.accel_z;
+        imu_ctx.filtered_data.gyro_x = imu_ctx.raw_data.gyro_x;
+        imu_ctx.filtered_data.gyro_y = imu_ctx.raw_data.gyro_y;
+        imu_ctx.filtered_data.gyro_z = imu_ctx.raw_data.gyro_z;
+        imu_ctx.filtered_data.filter_initialized = true;
+    } else {
+        // Exponential moving average filter
+        float alpha = imu_ctx.config.filter_alpha;
+        float beta = 1.0f - alpha;
+        
+        imu_ctx.filtered_data.accel_x = alpha * imu_ctx.raw_data.accel_x + beta * imu_ctx.filtered_data.accel_x;
+        imu_ctx.filtered_data.accel_y = alpha * imu_ctx.raw_data.accel_y + beta * imu_ctx.filtered_data.accel_y;
+        imu_ctx.filtered_data.accel_z = alpha * imu_ctx.raw_data.accel_z + beta * imu_ctx.filtered_data.accel_z;
+        imu_ctx.filtered_data.gyro_x = alpha * imu_ctx.raw_data.gyro_x + beta * imu_ctx.filtered_data.gyro_x;
+        imu_ctx.filtered_data.gyro_y = alpha * imu_ctx.raw_data.gyro_y + beta * imu_ctx.filtered_data.gyro_y;
+        imu_ctx.filtered_data.gyro_z = alpha * imu_ctx.raw_data.gyro_z + beta * imu_ctx.filtered_data.gyro_z;
+    }
+    
+    imu_ctx.read_count++;
+}
+
+/**
+ * @brief Scale the filtered data into controller output range
+ */
+static void imu_scale_filtered(imu_controller_data_t *controller_data)
+{
+    // Scale and clamp to int16_t range (-32768 to 32767)
+    // Note: Coordinate system mapping for controller compatibility
+    double temp_ax = imu_ctx.filtered_data.accel_y * imu_ctx.config.accel_scale_factor;
+    double temp_ay = imu_ctx.filtered_data.accel_z * imu_ctx.config.accel_scale_factor;
+    double temp_az = imu_ctx.filtered_data.accel_x * imu_ctx.config.accel_scale_factor;
+    
+    double temp_gx = imu_ctx.filtered_data.gyro_y * imu_ctx.config.gyro_scale_factor;
+    double temp_gy = imu_ctx.filtered_data.gyro_z * imu_ctx.config.gyro_scale_factor;
+    double temp_gz = imu_ctx.filtered_data.gyro_x * imu_ctx.config.gyro_scale_factor;
+    
+    // Clamp to int16_t range
+    controller_data->accel_x = (int16_t)((temp_ax < -32768) ? -32768 : ((temp_ax > 32767) ? 32767 : temp_ax));
+    controller_data->accel_y = (int16_t)((temp_ay < -32768) ? -32768 : ((temp_ay > 32767) ? 32767 : temp_ay));
+    controller_data->accel_z = (int16_t)((temp_az < -32768) ? -32768 : ((temp_az > 32767) ? 32767 : temp_az));
+    controller_data->gyro_x = (int16_t)((temp_gx < -32768) ? -32768 : ((temp_gx > 32767) ? 32767 : temp_gx));
+    controller_data->gyro_y = (int16_t)((temp_gy < -32768) ? -32768 : ((temp_gy > 32767) ? 32767 : temp_gy));
+    controller_data->gyro_z = (int16_t)((temp_gz < -32768) ? -32768 : ((temp_gz > 32767) ? 32767 : temp_gz));
+}
+
+/**
+ * @brief Feed one raw sample to the stillness detector and update the gyro bias per still window
+ */
+static void imu_bias_update(const int16_t raw[IMU_RAW_AXES])
+{
+    const int32_t n = IMU_BIAS_WINDOW_SAMPLES;
+    
+    for (int i = 0; i < IMU_RAW_AXES; i++) {
+        bias_est.sum[i] += raw[i];
+        bias_est.sum_sq[i] += (int32_t)raw[i] * raw[i];
+    }
+    
+    if (++bias_est.count < n) {
+        return;
+    }
+    
+    // Variance * N^2 = N * sum(x^2) - sum(x)^2 - no division per axis
+    bool still = true;
+    for (int i = 0; i < IMU_RAW_AXES && still; i++) {
+        int64_t var_n2 = n * bias_est.sum_sq[i] - (int64_t)bias_est.sum[i] * bias_est.sum[i];
+        int64_t limit = (i <= IMU_RAW_GZ) ? bias_est.gyro_var_limit : bias_est.accel_var_limit;
+        still = var_n2 <= limit;
+    }
+    for (int i = IMU_RAW_GX; i <= IMU_RAW_GZ && still; i++) {
+        still = abs(bias_est.sum[i] * 256 / n) <= bias_est.gyro_mean_limit_q8;
+    }
+    
+    if (!still) {
+        bias_est.still_windows = 0;
+    } else if (++bias_est.still_windows >= IMU_BIAS_STILL_WINDOWS) {
+        // Without a stored bias take the first still mean as-is, then track slowly
+        bool seeded = imu_ctx.calibration.calibrated || imu_ctx.bias_updates > 0;
+        
+        for (int i = IMU_RAW_GX; i <= IMU_RAW_GZ; i++) {
+            int32_t mean_q8 = bias_est.sum[i] * 256 / n;
+            if (seeded) {
+                imu_ctx.raw_offset_q8[i] += (mean_q8 - imu_ctx.raw_offset_q8[i]) >> IMU_BIAS_EMA_SHIFT;
+            } else {
+                imu_ctx.raw_offset_q8[i] = mean_q8;
+            }
+        }
+        
+        // Keep the SI calibration in step so imu_update_raw_params() doesn't undo the estimate
+        imu_ctx.calibration.gyro_offset_x = imu_ctx.raw_offset_q8[IMU_RAW_GX] / 256.0 * imu_ctx.gyro_sensitivity;
+        imu_ctx.calibration.gyro_offset_y = imu_ctx.raw_offset_q8[IMU_RAW_GY] / 256.0 * imu_ctx.gyro_sensitivity;
+        imu_ctx.calibration.gyro_offset_z = imu_ctx.raw_offset_q8[IMU_RAW_GZ] / 256.0 * imu_ctx.gyro_sensitivity;
+        imu_ctx.bias_updates++;
+    }
+    
+    memset(bias_est.sum, 0, sizeof(bias_est.sum));
+    memset(bias_est.sum_sq, 0, sizeof(bias_est.sum_sq));
+    bias_est.count = 0;
+}
+
+/**
+ * @brief Run one raw sample through integer calibration and low-pass filtering
+ */
+static void imu_process_raw_sample(const int16_t raw[IMU_RAW_AXES])
+{
+    if (imu_ctx.config.online_gyro_bias && imu_ctx.gyro_sensitivity > 0.0f) {
+        imu_bias_update(raw);
+    }
+    
+    for (int i = 0; i < IMU_RAW_AXES; i++) {
+        int32_t value_q8 = (int32_t)raw[i] * 256 - imu_ctx.raw_offset_q8[i];
+        
+        if (!imu_ctx.raw_filter_initialized) {
+            imu_ctx.raw_filtered_q8[i] = value_q8;
+        } else {
+            int64_t step = (int64_t)(value_q8 - imu_ctx.raw_filtered_q8[i]) * imu_ctx.raw_alpha_q8;
+            imu_ctx.raw_filtered_q8[i] += (int32_t)(step >> 8);
+        }
+    }
+    
+    imu_ctx.raw_filter_initialized = true;
+    imu_ctx.read_count++;
+}
+
+/**
+ * @brief Filtered LSB (Q8) times a Q16 gain, rounded and clamped to int16
+ */
+static int16_t imu_raw_to_wire(int32_t filtered_q8, int32_t gain_q16)
+{
+    int64_t value = ((int64_t)filtered_q8 * gain_q16 + (1 << 23)) >> 24;
+    
+    return (int16_t)CLAMP(value, INT16_MIN, INT16_MAX);
+}
+
+/**
+ * @brief Scale the integer filter state into controller output range
+ */
+static void imu_scale_raw(imu_controller_data_t *controller_data)
+{
+    const int32_t *f = imu_ctx.raw_filtered_q8;
+    
+    // Same coordinate mapping as imu_scale_filtered(): output X/Y/Z = sensor Y/Z/X
+    controller_data->accel_x = imu_raw_to_wire(f[IMU_RAW_XL_Y], imu_ctx.raw_accel_gain_q16);
+    controller_data->accel_y = imu_raw_to_wire(f[IMU_RAW_XL_Z], imu_ctx.raw_accel_gain_q16);
+    controller_data->accel_z = imu_raw_to_wire(f[IMU_RAW_XL_X], imu_ctx.raw_accel_gain_q16);
+    controller_data->gyro_x = imu_raw_to_wire(f[IMU_RAW_GY], imu_ctx.raw_gyro_gain_q16);
+    controller_data->gyro_y = imu_raw_to_wire(f[IMU_RAW_GZ], imu_ctx.raw_gyro_gain_q16);
+    controller_data->gyro_z = imu_raw_to_wire(f[IMU_RAW_GX], imu_ctx.raw_gyro_gain_q16);
+}
+
+/**
+ * @brief Convert an offset in SI units to LSB * 256 (0 until the full scale is known)
+ */
+static int32_t imu_offset_to_lsb_q8(double offset, float sensitivity)
+{
+    if (sensitivity <= 0.0f) {
+        return 0;
+    }
+    
+    double lsb_q8 = offset / sensitivity * 256.0;
+    return (int32_t)CLAMP(lsb_q8 < 0 ? lsb_q8 - 0.5 : lsb_q8 + 0.5, INT16_MIN * 256, INT16_MAX * 256);
+}
+
+/**
+ * @brief Recompute the integer path parameters from config, calibration and full scale
+ */
+static void imu_update_raw_params(void)
+{
+    imu_ctx.raw_offset_q8[IMU_RAW_GX] = imu_offset_to_lsb_q8(imu_ctx.calibration.gyro_offset_x, imu_ctx.gyro_sensitivity);
+    imu_ctx.raw_offset_q8[IMU_RAW_GY] = imu_offset_to_lsb_q8(imu_ctx.calibration.gyro_offset_y, imu_ctx.gyro_sensitivity);
+    imu_ctx.raw_offset_q8[IMU_RAW_GZ] = imu_offset_to_lsb_q8(imu_ctx.calibration.gyro_offset_z, imu_ctx.gyro_sensitivity);
+    imu_ctx.raw_offset_q8[IMU_RAW_XL_X] = imu_offset_to_lsb_q8(imu_ctx.calibration.accel_offset_x, imu_ctx.accel_sensitivity);
+    imu_ctx.raw_offset_q8[IMU_RAW_XL_Y] = imu_offset_to_lsb_q8(imu_ctx.calibration.accel_offset_y, imu_ctx.accel_sensitivity);
+    imu_ctx.raw_offset_q8[IMU_RAW_XL_Z] = imu_offset_to_lsb_q8(imu_ctx.calibration.accel_offset_z, imu_ctx.accel_sensitivity);
+    
+    // Stillness limits in raw LSB for the current full scale
+    if (imu_ctx.gyro_sensitivity > 0.0f && imu_ctx.accel_sensitivity > 0.0f) {
+        float gyro_std_lsb = IMU_BIAS_GYRO_STD_DPS * IMU_DEG_TO_RAD / imu_ctx.gyro_sensitivity;
+        float accel_std_lsb = IMU_BIAS_ACCEL_STD_G * IMU_STANDARD_GRAVITY / imu_ctx.accel_sensitivity;
+        float n2 = (float)IMU_BIAS_WINDOW_SAMPLES * IMU_BIAS_WINDOW_SAMPLES;
+        bias_est.gyro_var_limit = (int64_t)(gyro_std_lsb * gyro_std_lsb * n2);
+        bias_est.accel_var_limit = (int64_t)(accel_std_lsb * accel_std_lsb * n2);
+        bias_est.gyro_mean_limit_q8 = (int32_t)(IMU_BIAS_MAX_DPS * IMU_DEG_TO_RAD / imu_ctx.gyro_sensitivity * 256.0f);
+    }
+    
+    imu_ctx.raw_alpha_q8 = (uint16_t)(imu_ctx.config.filter_alpha * 256.0f + 0.5f);
+    imu_ctx.raw_accel_gain_q16 = (int32_t)(imu_ctx.accel_sensitivity * imu_ctx.config.accel_scale_factor * 65536.0f + 0.5f);
+    imu_ctx.raw_gyro_gain_q16 = (int32_t)(imu_ctx.gyro_sensitivity * imu_ctx.config.gyro_scale_factor * 65536.0f + 0.5f);
+}
+
+/**
+ * @brief Read the full scale set by the Zephyr driver and derive raw LSB sensitivities
+ */
+static int imu_read_full_scale(void)
+{
+    uint8_t ctrl[2];
+    
+    if (!imu_ctx.i2c_dev || !device_is_ready(imu_ctx.i2c_dev)) {
+        return -ENODEV;
+    }
+    
+    int ret = i2c_burst_read(imu_ctx.i2c_dev, imu_ctx.i2c_addr, LSM6DSL_REG_CTRL1_XL, ctrl, sizeof(ctrl));
+    if (ret != 0) {
+        return ret;
+    }
+    
+    static const float accel_mg_per_lsb[] = {0.061f, 0.488f, 0.122f, 0.244f};  // FS_XL: 2g, 16g, 4g, 8g
+    static const float gyro_mdps_per_lsb[] = {8.75f, 17.5f, 35.0f, 70.0f};     // FS_G: 250, 500, 1000, 2000 dps
+    float gyro_mdps = (ctrl[1] & 0x02) ? 4.375f : gyro_mdps_per_lsb[(ctrl[1] >> 2) & 0x03]; // FS_125
+    imu_ctx.accel_sensitivity = accel_mg_per_lsb[(ctrl[0] >> 2) & 0x03] * IMU_STANDARD_GRAVITY / 1000.0f;
+    imu_ctx.gyro_sensitivity = gyro_mdps * IMU_DEG_TO_RAD / 1000.0f;
+    
+    imu_update_raw_params();
+    return 0;
+}
+
+/**
+ * @brief Map an ODR in Hz to the LSM6DSL ODR_FIFO field (rounds up)
+ */
+static uint8_t imu_fifo_odr_code(uint16_t odr_hz)
+{
+    static const uint16_t rates[] = {13, 26, 52, 104, 208, 416, 833, 1660, 3330, 6660};
+    
+    for (int i = 0; i < ARRAY_SIZE(rates); i++) {
+        if (odr_hz <= rates[i]) {
+            return i + 1;
+        }
+    }
+    return ARRAY_SIZE(rates);
+}
+
+/**
+ * @brief Put gyro + accel into the FIFO in continuous mode at the gyro ODR
+ */
+static int imu_fifo_configure(void)
+{
+    const struct device *i2c = imu_ctx.i2c_dev;
+    uint16_t addr = imu_ctx.i2c_addr;
+    
+    // FIFO words use the same raw sensitivities as the output registers
+    int ret = imu_read_full_scale();
+    if (ret != 0) {
+        return ret;
+    }
+    
+    // Bypass first to clear stale data, then continuous (oldest samples overwritten if not drained)
+    uint8_t fifo_mode = (imu_fifo_odr_code(imu_ctx.config.gyro_odr) << 3) | LSM6DSL_FIFO_MODE_CONTINUOUS;
+    ret = i2c_reg_write_byte(i2c, addr, LSM6DSL_REG_FIFO_CTRL5, LSM6DSL_FIFO_MODE_BYPASS);
+    ret |= i2c_reg_write_byte(i2c, addr, LSM6DSL_REG_FIFO_CTRL1, LSM6DSL_FIFO_WATERMARK_WORDS & 0xFF);
+    ret |= i2c_reg_write_byte(i2c, addr, LSM6DSL_REG_FIFO_CTRL2, (LSM6DSL_FIFO_WATERMARK_WORDS >> 8) & 0x07);
+    ret |= i2c_reg_write_byte(i2c, addr, LSM6DSL_REG_FIFO_CTRL3, LSM6DSL_FIFO_CTRL3_NO_DEC);
+    ret |= i2c_reg_write_byte(i2c, addr, LSM6DSL_REG_FIFO_CTRL5, fifo_mode);
+    if (ret != 0) {
+        return -EIO;
+    }
+    
+    LOG_INF("IMU FIFO enabled: %d Hz continuous", imu_ctx.config.gyro_odr);
+    return 0;
+}
+
+/**
+ * @brief INT1 handler - FIFO reached the watermark, wake the reader thread
+ */
+static void imu_int1_handler(const struct device *port, struct gpio_callback *cb, uint32_t pins)
+{
+    ARG_UNUSED(port);
+    ARG_UNUSED(cb);
+    ARG_UNUSED(pins);
+    
+    k_sem_give(&imu_data_sem);
+}
+
+/**
+ * @brief Route the FIFO watermark to INT1 and arm the GPIO interrupt
+ */
+static int imu_irq_configure(void)
+{
+    if (!imu_int1.port || !gpio_is_ready_dt(&imu_int1)) {
+        return -ENODEV;
+    }
+    
+    int ret = gpio_pin_configure_dt(&imu_int1, GPIO_INPUT);
+    if (ret != 0) {
+        return ret;
+    }
+    
+    if (!imu_int1_cb_added) {
+        gpio_init_callback(&imu_int1_cb, imu_int1_handler, BIT(imu_int1.pin));
+        ret = gpio_add_callback(imu_int1.port, &imu_int1_cb);
+        if (ret != 0) {
+            return ret;
+        }
+        imu_int1_cb_added = true;
+    }
+    
+    ret = i2c_reg_write_byte(imu_ctx.i2c_dev, imu_ctx.i2c_addr, LSM6DSL_REG_INT1_CTRL, LSM6DSL_INT1_FTH);
+    if (ret != 0) {
+        return ret;
+    }
+    
+    // FTH stays high while the FIFO is above the watermark - the thread drains until it drops
+    return gpio_pin_interrupt_configure_dt(&imu_int1, GPIO_INT_EDGE_TO_ACTIVE);
+}
+
+/**
+ * @brief Publish one sample to the radio loop (drops the sample if the ring is full)
+ */
+static void imu_ring_push(const imu_timed_sample_t *sample)
+{
+    uint32_t head = atomic_get(&imu_ctx.ring_head);
+    uint32_t tail = atomic_get(&imu_ctx.ring_tail);
+    
+    if (head - tail >= IMU_SAMPLE_RING_SIZE) {
+        imu_ctx.ring_overflows++;
+        return;
+    }
+    
+    imu_sample_ring[head % IMU_SAMPLE_RING_SIZE] = *sample;
+    atomic_set(&imu_ctx.ring_head, head + 1);
+}
+
+/**
+ * @brief Reader thread - the only context that talks to the IMU while it runs
+ */
+static void imu_reader_thread_function(void *arg1, void *arg2, void *arg3)
+{
+    ARG_UNUSED(arg1);
+    ARG_UNUSED(arg2);
+    ARG_UNUSED(arg3);
+    
+    uint32_t period_us = 1000000 / MAX(imu_ctx.config.gyro_odr, 1);
+    uint32_t watermark_us = period_us * IMU_FIFO_WATERMARK_SAMPLES;
+    imu_controller_data_t samples[IMU_FIFO_MAX_SAMPLES];
+    imu_timed_sample_t sample;
+    
+    LOG_INF("IMU reader thread started (%s)", imu_ctx.irq_enabled ? "INT1 watermark" : "polled");
+    
+    while (!imu_ctx.reader_stop_requested) {
+        if (!imu_ctx.fifo_enabled) {
+            // No FIFO - poll one sample per ODR period
+            k_sleep(K_USEC(period_us));
+            if (!imu_is_available()) {
+                continue;
+            }
+            
+            sample.timestamp_us = (uint32_t)k_ticks_to_us_floor64(k_uptime_ticks());
+            if (imu_read_sample(&sample.data) == 0) {
+                imu_ring_push(&sample);
+            }
+            continue;
+        }
+        
+        // Wait for the watermark; the timeout covers a missed edge or a board without INT1
+        k_sem_take(&imu_data_sem, K_USEC(imu_ctx.irq_enabled ? watermark_us * IMU_IRQ_TIMEOUT_PERIODS
+                                                             : watermark_us));
+        if (!imu_is_available()) {
+            continue; // Calibrating or powered down
+        }
+        
+        int count;
+        do {
+            // Newest sample was taken just before the read - older ones are one ODR period apart
+            uint32_t now_us = (uint32_t)k_ticks_to_us_floor64(k_uptime_ticks());
+            count = imu_read_fifo(samples, ARRAY_SIZE(samples));
+            
+            for (int i = 0; i < count; i++) {
+                sample.data = samples[i];
+                sample.timestamp_us = now_us - (count - 1 - i) * period_us;
+                imu_ring_push(&sample);
+            }
+        } while (count == IMU_FIFO_MAX_SAMPLES && !imu_ctx.reader_stop_requested);
+    }
+    
+    LOG_INF("IMU reader thread stopped");
+    imu_ctx.reader_running = false;
+}
+
 /**
  * @brief Initialize the IMU driver system
  */
@@ -41,11 +522,13 @@ int imu_driver_init(const struct device *sensor_dev,
     
     // Clear the context
     memset(&imu_ctx, 0, sizeof(imu_ctx));
+    memset(&bias_est, 0, sizeof(bias_est));
     imu_ctx.status = IMU_STATUS_NOT_READY;
     
     // Store device references
     imu_ctx.sensor_dev = sensor_dev;
     imu_ctx.i2c_dev = i2c_dev;
+    imu_ctx.i2c_addr = DT_REG_ADDR(DT_NODELABEL(lsm6ds3tr_c));
     
     // Use provided config or defaults
     if (config) {
@@ -107,6 +590,32 @@ int imu_driver_init(const struct device *sensor_dev,
         return -ENODEV;  // Return error like original code would
     }
     
+    // Raw mode needs the LSB sensitivities; fall back to the float path without them
+    if (imu_ctx.config.raw_mode && imu_read_full_scale() != 0) {
+        LOG_WRN("IMU full scale unknown - using sensor_value path");
+        imu_ctx.config.raw_mode = false;
+    }
+    
+    // Batch samples in the sensor FIFO so every sample reaches the radio, not just one per loop
+    if (imu_ctx.config.use_fifo) {
+        ret = imu_fifo_configure();
+        if (ret == 0) {
+            imu_ctx.fifo_enabled = true;
+        } else {
+            LOG_WRN("IMU FIFO setup failed (%d) - falling back to polled reads", ret);
+        }
+    }
+    
+    // Watermark interrupt wakes the reader thread instead of it polling the FIFO
+    if (imu_ctx.fifo_enabled) {
+        ret = imu_irq_configure();
+        if (ret == 0) {
+            imu_ctx.irq_enabled = true;
+        } else {
+            LOG_WRN("IMU INT1 setup failed (%d) - reader thread will poll the FIFO", ret);
+        }
+    }
+    
     LOG_INF("=== IMU DRIVER INIT COMPLETE ===");
     return 0;
 }
@@ -171,55 +680,231 @@ int imu_read_raw_data(imu_raw_data_t *raw_data)
         return ret;
     }
     
-    // Convert to double values and store in context
-    imu_ctx.raw_data.accel_x = sensor_value_to_double(&accel[0]);
-    imu_ctx.raw_data.accel_y = sensor_value_to_double(&accel[1]);
-    imu_ctx.raw_data.accel_z = sensor_value_to_double(&accel[2]);
-    imu_ctx.raw_data.gyro_x = sensor_value_to_double(&gyro[0]);
-    imu_ctx.raw_data.gyro_y = sensor_value_to_double(&gyro[1]);
-    imu_ctx.raw_data.gyro_z = sensor_value_to_double(&gyro[2]);
-    imu_ctx.raw_data.timestamp = k_uptime_get_32();
+    // Convert to double values, then calibrate and filter
+    imu_process_sample(sensor_value_to_double(&accel[0]),
+                       sensor_value_to_double(&accel[1]),
+                       sensor_value_to_double(&accel[2]),
+                       sensor_value_to_double(&gyro[0]),
+                       sensor_value_to_double(&gyro[1]),
+                       sensor_value_to_double(&gyro[2]));
     
-    // Apply calibration offsets
-    imu_ctx.raw_data.accel_x -= imu_ctx.calibration.accel_offset_x;
-    imu_ctx.raw_data.accel_y -= imu_ctx.calibration.accel_offset_y;
-    imu_ctx.raw_data.accel_z -= imu_ctx.calibration.accel_offset_z;
-    imu_ctx.raw_data.gyro_x -= imu_ctx.calibration.gyro_offset_x;
-    imu_ctx.raw_data.gyro_y -= imu_ctx.calibration.gyro_offset_y;
-    imu_ctx.raw_data.gyro_z -= imu_ctx.calibration.gyro_offset_z;
+    // Copy data to output if requested
+    if (raw_data) {
+        *raw_data = imu_ctx.raw_data;
+    }
     
-    // Apply low-pass filter
-    if (!imu_ctx.filtered_data.filter_initialized) {
-        // Initialize filter with first reading
-        imu_ctx.filtered_data.accel_x = imu_ctx.raw_data.accel_x;
-        imu_ctx.filtered_data.accel_y = imu_ctx.raw_data.accel_y;
-        imu_ctx.filtered_data.accel_z = imu_ctx.raw_data.accel_z;
-        imu_ctx.filtered_data.gyro_x = imu_ctx.raw_data.gyro_x;
-        imu_ctx.filtered_data.gyro_y = imu_ctx.raw_data.gyro_y;
-        imu_ctx.filtered_data.gyro_z = imu_ctx.raw_data.gyro_z;
-        imu_ctx.filtered_data.filter_initialized = true;
-    } else {
-        // Exponential moving average filter
-        float alpha = imu_ctx.config.filter_alpha;
-        float beta = 1.0f - alpha;
+    return 0;
+}
+
+/**
+ * @brief Read one sample straight into controller output format
+ */
+int imu_read_sample(imu_controller_data_t *sample)
+{
+    if (!sample) {
+        return -EINVAL;
+    }
+    
+    if (!imu_ctx.config.raw_mode) {
+        int ret = imu_read_raw_data(NULL);
+        if (ret != 0) {
+            return ret;
+        }
+        return imu_get_controller_data(sample);
+    }
+    
+    // OUTX_L_G..OUTZ_H_XL in one burst - gyro and accel from the same output update
+    uint8_t buf[IMU_RAW_AXES * 2];
+    int ret = i2c_burst_read(imu_ctx.i2c_dev, imu_ctx.i2c_addr, LSM6DSL_REG_OUTX_L_G, buf, sizeof(buf));
+    if (ret != 0) {
+        imu_ctx.error_count++;
+        return ret;
+    }
+    
+    int16_t raw[IMU_RAW_AXES];
+    for (int axis = 0; axis < IMU_RAW_AXES; axis++) {
+        raw[axis] = (int16_t)sys_get_le16(&buf[axis * 2]);
+    }
+    imu_process_raw_sample(raw);
+    imu_scale_raw(sample);
+    
+    return 0;
+}
+
+/**
+ * @brief Drain all samples batched in the hardware FIFO
+ */
+int imu_read_fifo(imu_controller_data_t *samples, size_t max_samples)
+{
+    if (!samples) {
+        return -EINVAL;
+    }
+    
+    if (!imu_is_available() || !imu_ctx.fifo_enabled) {
+        return -ENODEV;
+    }
+    
+    // STATUS1/2 = unread word count + flags, STATUS3/4 = pattern index of the next word
+    uint8_t status[4];
+    int ret = i2c_burst_read(imu_ctx.i2c_dev, imu_ctx.i2c_addr, LSM6DSL_REG_FIFO_STATUS1, status, sizeof(status));
+    if (ret != 0) {
+        imu_ctx.error_count++;
+        return ret;
+    }
+    
+    if (status[1] & LSM6DSL_FIFO_STATUS2_OVER_RUN) {
+        imu_ctx.fifo_overruns++;
+    }
+    if (status[1] & LSM6DSL_FIFO_STATUS2_EMPTY) {
+        return 0;
+    }
+    
+    uint16_t words = ((status[1] & 0x07) << 8) | status[0];
+    uint16_t pattern = ((status[3] & 0x03) << 8) | status[2];
+    uint8_t buf[IMU_FIFO_MAX_SAMPLES * LSM6DSL_FIFO_BYTES_PER_SAMPLE];
+    
+    // Mid-sample after an overrun - discard words up to the next gyro X so samples stay aligned
+    if (pattern != 0 && pattern < LSM6DSL_FIFO_WORDS_PER_SAMPLE) {
+        uint16_t skip = LSM6DSL_FIFO_WORDS_PER_SAMPLE - pattern;
+        if (words < skip) {
+            return 0;
+        }
+        ret = i2c_burst_read(imu_ctx.i2c_dev, imu_ctx.i2c_addr, LSM6DSL_REG_FIFO_DATA_OUT_L, buf, skip * 2);
+        if (ret != 0) {
+            imu_ctx.error_count++;
+            return ret;
+        }
+        words -= skip;
+    }
+    
+    size_t count = MIN(words / LSM6DSL_FIFO_WORDS_PER_SAMPLE, MIN(max_samples, IMU_FIFO_MAX_SAMPLES));
+    if (count == 0) {
+        return 0;
+    }
+    
+    // FIFO_DATA_OUT rolls back from 0x3F to 0x3E, so one burst drains every sample
+    ret = i2c_burst_read(imu_ctx.i2c_dev, imu_ctx.i2c_addr, LSM6DSL_REG_FIFO_DATA_OUT_L,
+                         buf, count * LSM6DSL_FIFO_BYTES_PER_SAMPLE);
+    if (ret != 0) {
+        LOG_WRN("IMU FIFO read failed: %d", ret);
+        imu_ctx.error_count++;
+        return ret;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t *w = &buf[i * LSM6DSL_FIFO_BYTES_PER_SAMPLE];
         
-        imu_ctx.filtered_data.accel_x = alpha * imu_ctx.raw_data.accel_x + beta * imu_ctx.filtered_data.accel_x;
-        imu_ctx.filtered_data.accel_y = alpha * imu_ctx.raw_data.accel_y + beta * imu_ctx.filtered_data.accel_y;
-        imu_ctx.filtered_data.accel_z = alpha * imu_ctx.raw_data.accel_z + beta * imu_ctx.filtered_data.accel_z;
-        imu_ctx.filtered_data.gyro_x = alpha * imu_ctx.raw_data.gyro_x + beta * imu_ctx.filtered_data.gyro_x;
-        imu_ctx.filtered_data.gyro_y = alpha * imu_ctx.raw_data.gyro_y + beta * imu_ctx.filtered_data.gyro_y;
-        imu_ctx.filtered_data.gyro_z = alpha * imu_ctx.raw_data.gyro_z + beta * imu_ctx.filtered_data.gyro_z;
+        if (imu_ctx.config.raw_mode) {
+            int16_t raw[IMU_RAW_AXES];
+            for (int axis = 0; axis < IMU_RAW_AXES; axis++) {
+                raw[axis] = (int16_t)sys_get_le16(&w[axis * 2]);
+            }
+            imu_process_raw_sample(raw);
+            imu_scale_raw(&samples[i]);
+            continue;
+        }
+        
+        imu_process_sample((int16_t)sys_get_le16(&w[6]) * imu_ctx.accel_sensitivity,
+                           (int16_t)sys_get_le16(&w[8]) * imu_ctx.accel_sensitivity,
+                           (int16_t)sys_get_le16(&w[10]) * imu_ctx.accel_sensitivity,
+                           (int16_t)sys_get_le16(&w[0]) * imu_ctx.gyro_sensitivity,
+                           (int16_t)sys_get_le16(&w[2]) * imu_ctx.gyro_sensitivity,
+                           (int16_t)sys_get_le16(&w[4]) * imu_ctx.gyro_sensitivity);
+        imu_scale_filtered(&samples[i]);
     }
     
-    // Copy data to output if requested
-    if (raw_data) {
-        *raw_data = imu_ctx.raw_data;
+    return (int)count;
+}
+
+/**
+ * @brief Check if samples are batched in the hardware FIFO
+ */
+bool imu_fifo_is_enabled(void)
+{
+    return imu_ctx.fifo_enabled;
+}
+
+/**
+ * @brief Start the thread that owns all IMU I2C traffic
+ */
+int imu_start_reader_thread(void)
+{
+    if (!imu_is_available()) {
+        return -ENODEV;
     }
     
-    imu_ctx.read_count++;
+    if (imu_ctx.reader_running) {
+        return 0;
+    }
+    
+    // Start from an empty FIFO and ring so the first samples aren't stale
+    if (imu_ctx.fifo_enabled) {
+        imu_fifo_configure();
+    }
+    atomic_set(&imu_ctx.ring_tail, atomic_get(&imu_ctx.ring_head));
+    k_sem_reset(&imu_data_sem);
+    
+    imu_ctx.reader_stop_requested = false;
+    imu_ctx.reader_running = true;
+    imu_ctx.reader_thread_tid = k_thread_create(&imu_ctx.reader_thread_data,
+                                                imu_reader_stack,
+                                                K_THREAD_STACK_SIZEOF(imu_reader_stack),
+                                                imu_reader_thread_function,
+                                                NULL, NULL, NULL,
+                                                K_PRIO_PREEMPT(IMU_READER_PRIORITY),
+                                                0, K_NO_WAIT);
+    k_thread_name_set(imu_ctx.reader_thread_tid, "imu_reader");
+    
     return 0;
 }
 
+/**
+ * @brief Stop the IMU reader thread
+ */
+int imu_stop_reader_thread(void)
+{
+    if (!imu_ctx.reader_running) {
+        return 0;
+    }
+    
+    imu_ctx.reader_stop_requested = true;
+    k_sem_give(&imu_data_sem);
+    
+    int ret = k_thread_join(&imu_ctx.reader_thread_data, K_SECONDS(1));
+    if (ret != 0) {
+        LOG_WRN("IMU reader thread stop timeout");
+        return ret;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Take the samples published by the reader thread
+ */
+int imu_get_samples(imu_timed_sample_t *samples, size_t max_samples)
+{
+    if (!samples) {
+        return -EINVAL;
+    }
+    
+    if (!imu_ctx.reader_running) {
+        return -ENODEV;
+    }
+    
+    uint32_t tail = atomic_get(&imu_ctx.ring_tail);
+    uint32_t head = atomic_get(&imu_ctx.ring_head);
+    size_t count = 0;
+    
+    while (tail != head && count < max_samples) {
+        samples[count++] = imu_sample_ring[tail % IMU_SAMPLE_RING_SIZE];
+        tail++;
+    }
+    atomic_set(&imu_ctx.ring_tail, tail);
+    
+    return (int)count;
+}
+
 /**
  * @brief Get the latest filtered IMU data
  */
@@ -234,6 +919,18 @@ int imu_get_filtered_data(imu_filtered_data_t *filtered_data)
     }
     
     *filtered_data = imu_ctx.filtered_data;
+    
+    // Raw mode keeps its state in LSB - convert on request (debug only)
+    if (imu_ctx.config.raw_mode && imu_ctx.raw_filter_initialized) {
+        const int32_t *f = imu_ctx.raw_filtered_q8;
+        filtered_data->accel_x = f[IMU_RAW_XL_X] / 256.0 * imu_ctx.accel_sensitivity;
+        filtered_data->accel_y = f[IMU_RAW_XL_Y] / 256.0 * imu_ctx.accel_sensitivity;
+        filtered_data->accel_z = f[IMU_RAW_XL_Z] / 256.0 * imu_ctx.accel_sensitivity;
+        filtered_data->gyro_x = f[IMU_RAW_GX] / 256.0 * imu_ctx.gyro_sensitivity;
+        filtered_data->gyro_y = f[IMU_RAW_GY] / 256.0 * imu_ctx.gyro_sensitivity;
+        filtered_data->gyro_z = f[IMU_RAW_GZ] / 256.0 * imu_ctx.gyro_sensitivity;
+        filtered_data->filter_initialized = true;
+    }
     return 0;
 }
 
@@ -246,27 +943,20 @@ int imu_get_controller_data(imu_controller_data_t *controller_data)
         return -EINVAL;
     }
     
-    if (!imu_is_available() || !imu_ctx.filtered_data.filter_initialized) {
+    if (!imu_is_available()) {
         return -ENODEV;
     }
     
-    // Scale and clamp to int16_t range (-32768 to 32767)
-    // Note: Coordinate system mapping for controller compatibility
-    double temp_ax = imu_ctx.filtered_data.accel_y * imu_ctx.config.accel_scale_factor;
-    double temp_ay = imu_ctx.filtered_data.accel_z * imu_ctx.config.accel_scale_factor;
-    double temp_az = imu_ctx.filtered_data.accel_x * imu_ctx.config.accel_scale_factor;
+    if (imu_ctx.config.raw_mode && imu_ctx.raw_filter_initialized) {
+        imu_scale_raw(controller_data);
+        return 0;
+    }
     
-    double temp_gx = imu_ctx.filtered_data.gyro_y * imu_ctx.config.gyro_scale_factor;
-    double temp_gy = imu_ctx.filtered_data.gyro_z * imu_ctx.config.gyro_scale_factor;
-    double temp_gz = imu_ctx.filtered_data.gyro_x * imu_ctx.config.gyro_scale_factor;
+    if (!imu_ctx.filtered_data.filter_initialized) {
+        return -ENODEV;
+    }
     
-    // Clamp to int16_t range
-    controller_data->accel_x = (int16_t)((temp_ax < -32768) ? -32768 : ((temp_ax > 32767) ? 32767 : temp_ax));
-    controller_data->accel_y = (int16_t)((temp_ay < -32768) ? -32768 : ((temp_ay > 32767) ? 32767 : temp_ay));
-    controller_data->accel_z = (int16_t)((temp_az < -32768) ? -32768 : ((temp_az > 32767) ? 32767 : temp_az));
-    controller_data->gyro_x = (int16_t)((temp_gx < -32768) ? -32768 : ((temp_gx > 32767) ? 32767 : temp_gx));
-    controller_data->gyro_y = (int16_t)((temp_gy < -32768) ? -32768 : ((temp_gy > 32767) ? 32767 : temp_gy));
-    controller_data->gyro_z = (int16_t)((temp_gz < -32768) ? -32768 : ((temp_gz > 32767) ? 32767 : temp_gz));
+    imu_scale_filtered(controller_data);
     
     return 0;
 }
@@ -320,6 +1010,7 @@ int imu_set_filter_alpha(float alpha)
     }
     
     imu_ctx.config.filter_alpha = alpha;
+    imu_update_raw_params();
     LOG_INF("IMU filter alpha set to %.3f", alpha);
     return 0;
 }
@@ -335,6 +1026,7 @@ int imu_set_scale_factors(float accel_scale, float gyro_scale)
     
     imu_ctx.config.accel_scale_factor = accel_scale;
     imu_ctx.config.gyro_scale_factor = gyro_scale;
+    imu_update_raw_params();
     
     LOG_INF("IMU scale factors updated: Accel=%.1f, Gyro=%.1f", accel_scale, gyro_scale);
     return 0;
@@ -387,6 +1079,7 @@ int imu_start_calibration(uint32_t duration_ms)
         imu_ctx.calibration.gyro_offset_y = gyro_sum_y / samples;
         imu_ctx.calibration.gyro_offset_z = gyro_sum_z / samples;
         imu_ctx.calibration.calibrated = true;
+        imu_update_raw_params();
         
         LOG_INF("=== CALIBRATION COMPLETE ===");
         LOG_INF("Samples: %u", samples);
@@ -439,16 +1132,67 @@ int imu_set_calibration(const imu_calibration_t *calibration)
     }
     
     imu_ctx.calibration = *calibration;
+    imu_update_raw_params();
     LOG_INF("IMU calibration data loaded");
     return 0;
 }
 
+/**
+ * @brief Get the gyro bias in use
+ */
+int imu_get_gyro_bias_mdps(int16_t bias_mdps[3])
+{
+    if (!bias_mdps) {
+        return -EINVAL;
+    }
+    
+    const double rad_to_mdps = 1000.0 / IMU_DEG_TO_RAD;
+    double bias[3] = {
+        imu_ctx.calibration.gyro_offset_x * rad_to_mdps,
+        imu_ctx.calibration.gyro_offset_y * rad_to_mdps,
+        imu_ctx.calibration.gyro_offset_z * rad_to_mdps,
+    };
+    
+    for (int i = 0; i < 3; i++) {
+        bias_mdps[i] = (int16_t)CLAMP(bias[i] < 0 ? bias[i] - 0.5 : bias[i] + 0.5, INT16_MIN, INT16_MAX);
+    }
+    return 0;
+}
+
+/**
+ * @brief Seed the gyro bias
+ */
+int imu_set_gyro_bias_mdps(const int16_t bias_mdps[3])
+{
+    if (!bias_mdps) {
+        return -EINVAL;
+    }
+    
+    const double mdps_to_rad = IMU_DEG_TO_RAD / 1000.0;
+    imu_ctx.calibration.gyro_offset_x = bias_mdps[0] * mdps_to_rad;
+    imu_ctx.calibration.gyro_offset_y = bias_mdps[1] * mdps_to_rad;
+    imu_ctx.calibration.gyro_offset_z = bias_mdps[2] * mdps_to_rad;
+    imu_ctx.calibration.calibrated = true;
+    imu_update_raw_params();
+    
+    return 0;
+}
+
+/**
+ * @brief Number of online gyro bias updates since init
+ */
+uint32_t imu_get_bias_update_count(void)
+{
+    return imu_ctx.bias_updates;
+}
+
 /**
  * @brief Reset calibration to defaults
  */
 int imu_reset_calibration(void)
 {
     memset(&imu_ctx.calibration, 0, sizeof(imu_ctx.calibration));
+    imu_update_raw_params();
     LOG_DBG("IMU calibration reset to defaults");
     return 0;
 }
@@ -530,6 +1274,9 @@ int imu_get_debug_info(char *buffer, size_t buffer_size)
         "Filter Alpha: %.3f\n"
         "Accel ODR: %u Hz\n"
         "Gyro ODR: %u Hz\n"
+        "FIFO: %s (overruns: %u, INT1: %s)\n"
+        "Reader: %s (ring overflows: %u)\n"
+        "Gyro bias updates: %u\n"
         "Calibrated: %s\n",
         imu_ctx.status,
         imu_ctx.sensor_dev,
@@ -539,6 +1286,12 @@ int imu_get_debug_info(char *buffer, size_t buffer_size)
         imu_ctx.config.filter_alpha,
         imu_ctx.config.accel_odr,
         imu_ctx.config.gyro_odr,
+        imu_ctx.fifo_enabled ? "ON" : "OFF",
+        imu_ctx.fifo_overruns,
+        imu_ctx.irq_enabled ? "ON" : "OFF",
+        imu_ctx.reader_running ? "RUNNING" : "STOPPED",
+        imu_ctx.ring_overflows,
+        imu_ctx.bias_updates,
         imu_ctx.calibration.calibrated ? "YES" : "NO");
 }
 
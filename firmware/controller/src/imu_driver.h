@@ -20,6 +20,18 @@
 extern "C" {
 #endif
 
+/** Maximum samples drained from the hardware FIFO per imu_read_fifo() call */
+#define IMU_FIFO_MAX_SAMPLES 16
+
+/** FIFO level (samples) that raises INT1 and wakes the reader thread */
+#define IMU_FIFO_WATERMARK_SAMPLES 2
+
+/** Processed samples buffered between the reader thread and the radio loop (power of two) */
+#define IMU_SAMPLE_RING_SIZE 32
+
+/** Online gyro bias: stillness is judged over windows of this many samples (~300 ms at 416 Hz) */
+#define IMU_BIAS_WINDOW_SAMPLES 128
+
 /**
  * @brief IMU driver status enumeration
  */
@@ -37,10 +49,13 @@ typedef enum {
 typedef struct {
     uint16_t accel_odr;              /**< Accelerometer output data rate (Hz) */
     uint16_t gyro_odr;               /**< Gyroscope output data rate (Hz) */
-    float filter_alpha;              /**< Low-pass filter coefficient (0.0-1.0) */
+    float filter_alpha;              /**< Low-pass filter coefficient per sample (0.0-1.0) */
     bool auto_calibrate;             /**< Enable automatic calibration on startup */
     float accel_scale_factor;        /**< Accelerometer scaling factor */
     float gyro_scale_factor;         /**< Gyroscope scaling factor */
+    bool use_fifo;                   /**< Batch samples in the sensor FIFO (gyro ODR) instead of polling */
+    bool raw_mode;                   /**< Integer path from raw registers to wire int16 (float path for debug only) */
+    bool online_gyro_bias;           /**< Re-estimate gyro bias whenever the controller is still (raw mode) */
 } imu_config_t;
 
 /**
@@ -81,6 +96,14 @@ typedef struct {
     int16_t gyro_z;                  /**< Scaled gyroscope Z (-32768 to 32767) */
 } imu_controller_data_t;
 
+/**
+ * @brief Processed sample published by the reader thread
+ */
+typedef struct {
+    imu_controller_data_t data;      /**< Scaled sample */
+    uint32_t timestamp_us;           /**< Estimated sampling time (k_cycle_get_32 based, us) */
+} imu_timed_sample_t;
+
 /**
  * @brief IMU calibration data structure
  */
@@ -107,6 +130,26 @@ typedef struct {
     imu_calibration_t calibration;   /**< Calibration data */
     uint32_t read_count;             /**< Total number of successful reads */
     uint32_t error_count;            /**< Total number of read errors */
+    bool fifo_enabled;               /**< Hardware FIFO configured and in use */
+    uint16_t i2c_addr;               /**< Sensor I2C address (for direct FIFO access) */
+    float accel_sensitivity;         /**< FIFO raw LSB -> m/s² */
+    float gyro_sensitivity;          /**< FIFO raw LSB -> rad/s */
+    uint32_t fifo_overruns;          /**< FIFO overrun events (samples lost) */
+    int32_t raw_offset_q8[6];        /**< Calibration offsets in LSB * 256 (Gx Gy Gz XLx XLy XLz) */
+    int32_t raw_filtered_q8[6];      /**< Integer low-pass state in LSB * 256 (same order) */
+    bool raw_filter_initialized;     /**< Integer filter has seen its first sample */
+    uint16_t raw_alpha_q8;           /**< filter_alpha * 256 */
+    int32_t raw_accel_gain_q16;      /**< Accel LSB -> wire units (sensitivity * scale, Q16) */
+    int32_t raw_gyro_gain_q16;       /**< Gyro LSB -> wire units (sensitivity * scale, Q16) */
+    uint32_t bias_updates;           /**< Online gyro bias updates applied */
+    bool irq_enabled;                /**< FIFO watermark interrupt wired to the reader thread */
+    struct k_thread reader_thread_data; /**< Reader thread control block */
+    k_tid_t reader_thread_tid;       /**< Reader thread ID */
+    bool reader_running;             /**< Reader thread is alive */
+    bool reader_stop_requested;      /**< Ask the reader thread to exit */
+    atomic_t ring_head;              /**< Samples published (written by reader thread) */
+    atomic_t ring_tail;              /**< Samples consumed (written by radio loop) */
+    uint32_t ring_overflows;         /**< Samples dropped because the consumer fell behind */
 } imu_context_t;
 
 // ============================================================================
@@ -157,6 +200,57 @@ int imu_get_filtered_data(imu_filtered_data_t *filtered_data);
  */
 int imu_get_controller_data(imu_controller_data_t *controller_data);
 
+/**
+ * @brief Read one sample straight into controller output format
+ *
+ * In raw mode this is a single 12-byte register burst followed by integer
+ * calibration, filtering and scaling; otherwise it uses the sensor API float path.
+ * @param sample Pointer to store the scaled sample
+ * @return 0 on success, negative error code on failure
+ */
+int imu_read_sample(imu_controller_data_t *sample);
+
+/**
+ * @brief Drain all samples batched in the hardware FIFO
+ *
+ * Each sample goes through calibration, filtering and scaling in order, so the
+ * last entry equals what imu_get_controller_data() returns afterwards.
+ * @param samples Array to store scaled samples (oldest first)
+ * @param max_samples Capacity of the array
+ * @return Number of samples read (0 if FIFO empty), negative error code on failure
+ */
+int imu_read_fifo(imu_controller_data_t *samples, size_t max_samples);
+
+/**
+ * @brief Check if samples are batched in the hardware FIFO
+ * @return true if imu_read_fifo() should be used instead of imu_read_raw_data()
+ */
+bool imu_fifo_is_enabled(void);
+
+/**
+ * @brief Start the thread that owns all IMU I2C traffic
+ *
+ * The thread sleeps on the FIFO watermark interrupt (or polls at the ODR without
+ * FIFO/interrupt), burst-reads the FIFO and publishes timestamped samples into a
+ * lock-free ring. Callers then only copy samples with imu_get_samples().
+ * @return 0 on success, negative error code on failure
+ */
+int imu_start_reader_thread(void);
+
+/**
+ * @brief Stop the IMU reader thread
+ * @return 0 on success, negative error code on failure
+ */
+int imu_stop_reader_thread(void);
+
+/**
+ * @brief Take the samples published by the reader thread (never touches I2C)
+ * @param samples Array to store samples (oldest first)
+ * @param max_samples Capacity of the array
+ * @return Number of samples copied (0 if none are new), negative error code on failure
+ */
+int imu_get_samples(imu_timed_sample_t *samples, size_t max_samples);
+
 // ============================================================================
 // Configuration Functions
 // ============================================================================
@@ -171,7 +265,7 @@ int imu_set_data_rates(uint16_t accel_odr, uint16_t gyro_odr);
 
 /**
  * @brief Set low-pass filter coefficient
- * @param alpha Filter coefficient (0.0 = max filtering, 1.0 = no filtering)
+ * @param alpha Filter coefficient per sample at the configured ODR (0.0 = max filtering, 1.0 = no filtering)
  * @return 0 on success, negative error code on failure
  */
 int imu_set_filter_alpha(float alpha);
@@ -215,6 +309,26 @@ int imu_get_calibration(imu_calibration_t *calibration);
  */
 int imu_set_calibration(const imu_calibration_t *calibration);
 
+/**
+ * @brief Get the gyro bias in use (explicit calibration or online estimate)
+ * @param bias_mdps Sensor-frame X/Y/Z bias in millidegrees per second
+ * @return 0 on success, negative error code on failure
+ */
+int imu_get_gyro_bias_mdps(int16_t bias_mdps[3]);
+
+/**
+ * @brief Seed the gyro bias (e.g. from storage); online estimation continues from it
+ * @param bias_mdps Sensor-frame X/Y/Z bias in millidegrees per second
+ * @return 0 on success, negative error code on failure
+ */
+int imu_set_gyro_bias_mdps(const int16_t bias_mdps[3]);
+
+/**
+ * @brief Number of online gyro bias updates since init
+ * @return Update count (changes whenever the bias may have moved)
+ */
+uint32_t imu_get_bias_update_count(void);
+
 /**
  * @brief Reset calibration to defaults
  * @return 0 on success, negative error code on failure
@@ -38,6 +38,7 @@
 #include <nrfx_saadc.h>
 #endif
 #include <math.h>
+#include <zephyr/sys/byteorder.h>
 #include <esb.h>
 #include "IQS7211E.h"
 #include "controller_storage.h"
@@ -49,6 +50,7 @@
 #include "analog_driver.h"
 #include "esb_comm_driver.h"
 #include "power_mgmt_driver.h"
+#include "i2c_bus_driver.h"
 #include "IQS7211E_init.h"
 // #include "trackpad_driver.h"
 
@@ -63,10 +65,9 @@ static display_analog_data_t display_analog_data = {0};
 static uint8_t calibration_phase = 0;      // 0=centering, 1=movement
 static uint8_t calibration_progress = 0;   // 0-100%
 // REMOVED display_mutex - was causing priority inversion and 100-160ms thread delays
-// Main thread (200Hz) calling display_set_screen competed with display thread (20Hz)
+// The UI work queue calling display_set_screen competed with the display thread (20Hz)
 
-// I2C bus protection - REMOVED due to causing thread delays
-// static K_MUTEX_DEFINE(i2c1_mutex);
+// I2C bus protection - i2c1 is arbitrated by i2c_bus_driver (trackpad > haptics > display)
 
 // Thread health monitoring
 static uint32_t trackpad_thread_heartbeat = 0;
@@ -158,6 +159,11 @@ static const struct device *i2c_dev;
 
 // IMU sensor - Now using imu_driver library
 
+// Online gyro bias persistence - flash writes are rate limited, small drift isn't worth a write
+#define GYRO_BIAS_CHECK_INTERVAL_MS     60000   // How often the live estimate is compared with flash
+#define GYRO_BIAS_SAVE_MIN_INTERVAL_MS  600000  // At most one calibration write per 10 minutes
+#define GYRO_BIAS_SAVE_THRESHOLD_MDPS   20      // Change needed before a write is worth it
+
 // ADC for analog inputs - Now using analog_driver library
 static const struct device *adc_dev;
 
@@ -176,7 +182,10 @@ static controller_preferences_t controller_preferences;
 
 // ESB payload structures - now using ESB communication driver
 // Controller state
+// Latest input state - each producer writes only its own fields under the lock,
+// the radio stage sends a snapshot of the whole block
 static esb_controller_data_t controller_data = {0};
+static struct k_spinlock controller_data_lock;
 
 // Function declarations
 void buttons_init(void);                      // Initialize button driver
@@ -187,8 +196,11 @@ void read_analog_inputs(void);                // Read analog using driver
 void print_analog_values(void);               // Debug: print all analog values
 void calibrate_analog_inputs(void);           // Calibrate analog using driver
 void read_trackpad_inputs(void);              // Read trackpad using driver
+void check_trackpad_haptic_feedback(uint16_t new_x, uint16_t new_y); // Velocity-scaled detent ticks
+void trackpad_detent_reset(void);             // Finger lifted - restart detent tracking
 void read_imu_inputs(void);                   // Read IMU using driver
-esb_comm_status_t send_controller_data(void); // Send data using ESB driver
+void save_gyro_bias_if_changed(uint32_t now); // Persist the online gyro bias estimate
+esb_comm_status_t send_controller_data(const esb_controller_data_t *data); // Send a snapshot using ESB driver
 void power_mgmt_init(void);                   // Initialize power management driver
 void ui_init(void);                           // UI placeholder functions
 void ui_create_main_screen(void);
@@ -197,34 +209,73 @@ void ui_create_calibration_screen(void);
 void ui_update_data(void);
 void ui_handle_input(void);
 
+// Host rumble amplitude from an ACK payload (radio ISR) - haptic_rumble only posts to its work queue
+static void rumble_ack_handler(uint8_t amplitude)
+{
+        haptic_rumble(amplitude);
+}
+
+// Radio stage - the only thread that talks to the ESB driver. It wakes on its slot tick or an
+// urgent input change, pulls the latest state and publishes one snapshot; combos, UI and
+// logging run on the UI work queue so nothing they do can move a transmission
+#define RADIO_STAGE_STACK_SIZE  2048
+#define RADIO_STAGE_PRIORITY    4       // Above every producer thread (trackpad is 5)
+#define RADIO_FALLBACK_DELAY_MS 8       // Pacing without the slot timer when the dongle sent no delay
+#define RADIO_SAMPLE_LEAD_US    400     // Slot tick this long before our TX slot: wake + update + publish, with margin
+
+#define RADIO_WAKE_SLOT         BIT(0)  // Slot timer tick, RADIO_SAMPLE_LEAD_US before our slot
+#define RADIO_WAKE_URGENT       BIT(1)  // Debounced button edge
+
+static K_SEM_DEFINE(radio_wake_sem, 0, 1);
+
+static struct
+{
+        atomic_t wake_events;           // RADIO_WAKE_* bits since the last wake
+        atomic_t reset_requested;       // ESB watchdog asked for a driver re-init
+        uint32_t next_slot_us;          // TX slot the last slot tick sampled for (esb_comm_local_time_us)
+        uint32_t heartbeat;             // Uptime of the last wake
+        // Read by the UI work queue for the periodic stats log
+        uint32_t publishes;
+        uint32_t slot_wakes;
+        uint32_t urgent_wakes;
+        uint32_t errors;                // Consecutive failed publishes
+        esb_comm_status_t last_status;
+        uint32_t update_max_us;         // Pulling the producers into controller_data
+        uint32_t publish_max_us;        // Wake to snapshot handed to the driver
+        int32_t slot_margin_min_us;     // Snapshot handed to the driver -> TX slot, negative = missed the slot
+} radio_stage = {.slot_margin_min_us = INT32_MAX};
+
+// Slot timer tick (radio ISR) - sample and publish now, the snapshot goes out at next_slot_us
+static void radio_slot_handler(uint32_t next_slot_us)
+{
+        radio_stage.next_slot_us = next_slot_us;
+        atomic_or(&radio_stage.wake_events, RADIO_WAKE_SLOT);
+        k_sem_give(&radio_wake_sem);
+}
+
 // Initialize ESB communication using ESB driver library
 void esb_comm_init(void)
 {
         LOG_INF("Initializing ESB communication using driver library...");
 
         // Configure ESB communication
-        // Configure timing with controller-specific offset to prevent collisions
-        uint32_t base_interval = 5;   // 5ms base for RIGHT controller
-        uint32_t retry_interval = 10; // 10ms retry for RIGHT controller
-
-        // LEFT controller gets +2ms offset to stagger transmissions
-        if (CONTROLLER_ID == 1)
-        {                            // LEFT controller
-                base_interval += 2;  // 7ms instead of 5ms
-                retry_interval += 2; // 12ms instead of 10ms
-        }
+        // Both halves share the same timing - collisions are avoided by the TDMA slot timer
+        // (RIGHT = slot 0, LEFT = slot 1), these intervals are only the fallback pacing
+        uint32_t base_interval = 5;   // 5ms fallback base interval
+        uint32_t retry_interval = 10; // 10ms fallback retry interval
 
         esb_comm_config_t esb_config = {
             .controller_id = CONTROLLER_ID,
             .base_tx_interval_ms = base_interval,
             .retry_interval_ms = retry_interval,
             .rf_channel = 50,   // RF channel 50 (2450 MHz) - MUST match dongle
-            .status_led = &led0 // Use LED0 for status indication
+            .status_led = &led0, // Use LED0 for status indication
+            .sample_lead_us = RADIO_SAMPLE_LEAD_US // Sample just in time for our slot
         };
 
-        LOG_INF("Controller %d ESB timing: base=%dms, retry=%dms (offset for collision avoidance)",
+        LOG_INF("Controller %d ESB timing: base=%dms, retry=%dms (fallback only)",
                 CONTROLLER_ID, base_interval, retry_interval);
-        LOG_INF("Note: Actual timing controlled by dongle ACK payload when available");
+        LOG_INF("Note: Actual timing controlled by TDMA slot timer, phase-locked via dongle ACK payload");
 
         esb_comm_status_t status = esb_comm_driver_init(&esb_config);
         if (status != ESB_COMM_STATUS_OK)
@@ -233,6 +284,12 @@ void esb_comm_init(void)
                 return;
         }
 
+        // Host rumble rides on every ACK payload
+        esb_comm_register_rumble_callback(rumble_ack_handler);
+
+        // Every slot of ours wakes the radio stage
+        esb_comm_register_slot_callback(radio_slot_handler);
+
         // Enable ACK payload based timing
         status = esb_comm_enable_ack_timing(true);
         if (status == ESB_COMM_STATUS_OK)
@@ -248,30 +305,12 @@ void esb_comm_init(void)
 }
 
 // Send controller data using ESB driver library with ACK payload timing
-esb_comm_status_t send_controller_data(void)
+esb_comm_status_t send_controller_data(const esb_controller_data_t *data)
 {
         // Use the ESB communication driver for transmission
-        esb_comm_status_t status = esb_comm_send_data(&controller_data);
-
-        // Process ACK payload data if transmission was successful
-        if (status == ESB_COMM_STATUS_OK)
-        {
-                // Check for rumble data from dongle
-                uint8_t left_rumble, right_rumble;
-                esb_comm_status_t rumble_status = esb_comm_get_rumble_data(&left_rumble, &right_rumble);
+        esb_comm_status_t status = esb_comm_send_data(data);
 
-                if (rumble_status == ESB_COMM_STATUS_OK && (left_rumble > 0 || right_rumble > 0))
-                {
-                        // TODO: Implement rumble motor control when hardware is ready
-                        static uint32_t last_rumble_log = 0;
-                        uint32_t now = k_uptime_get_32();
-                        if ((now - last_rumble_log) > 1000)
-                        { // Log every 1 second to avoid spam
-                                LOG_DBG("Rumble data received - Left: %d/15, Right: %d/15", left_rumble, right_rumble);
-                                last_rumble_log = now;
-                        }
-                }
-        }
+        // Rumble from the ACK payloads is applied by rumble_ack_handler straight from the radio ISR
 
         // Track radio busy conditions
         static uint32_t busy_count = 0;
@@ -322,21 +361,11 @@ esb_comm_status_t send_controller_data(void)
         return status;
 }
 
-// Simulate different controller inputs
+// Pull the producers that publish into their own driver buffers (buttons, ADC, IMU) into
+// controller_data - every read is a copy, nothing here waits on a bus
 void update_controller_data(void)
 {
-        // Clear previous input state but preserve controller ID in flags
-        controller_data.buttons = 0;
-        controller_data.flags &= 0x80; // Keep only controller ID (bit 7), clear all other flags
-        // controller_data.stickX = 0;
-        // controller_data.stickY = 0;
-        // controller_data.trigger = 0;
-        controller_data.accelX = 0;
-        controller_data.accelY = 0;
-        controller_data.accelZ = 0;
-        controller_data.gyroX = 0;
-        controller_data.gyroY = 0;
-        controller_data.gyroZ = 0;
+        // Fields keep their last value until a producer replaces them
 
         // Read real inputs using new driver libraries with timing diagnostics
         uint32_t start_cycles, end_cycles, duration_us;
@@ -362,9 +391,11 @@ void update_controller_data(void)
 
 #else
         // ADC DISABLED FOR FREEZE DEBUG
+        k_spinlock_key_t key = k_spin_lock(&controller_data_lock);
         controller_data.stickX = 0;
         controller_data.stickY = 0;
         controller_data.trigger = 0;
+        k_spin_unlock(&controller_data_lock, key);
 #endif
         end_cycles = k_cycle_get_32();
         duration_us = k_cyc_to_us_floor32(end_cycles - start_cycles);
@@ -385,12 +416,14 @@ void update_controller_data(void)
         read_imu_inputs();
 #else
         // IMU DISABLED FOR FREEZE DEBUG
+        k_spinlock_key_t imu_key = k_spin_lock(&controller_data_lock);
         controller_data.accelX = 0;
         controller_data.accelY = 0;
         controller_data.accelZ = 0;
         controller_data.gyroX = 0;
         controller_data.gyroY = 0;
         controller_data.gyroZ = 0;
+        k_spin_unlock(&controller_data_lock, imu_key);
 #endif
         end_cycles = k_cycle_get_32();
         duration_us = k_cyc_to_us_floor32(end_cycles - start_cycles);
@@ -404,11 +437,117 @@ void update_controller_data(void)
         }
 }
 
+// Radio stage thread - see radio_stage above
+void radio_thread_entry(void *p1, void *p2, void *p3)
+{
+        ARG_UNUSED(p1);
+        ARG_UNUSED(p2);
+        ARG_UNUSED(p3);
+
+        uint16_t wait_ms = RADIO_FALLBACK_DELAY_MS;
+        uint32_t consecutive_busy_count = 0;
+
+        while (1)
+        {
+                // Slot ticks arrive every superframe - the timeout only paces the fallback path
+                k_sem_take(&radio_wake_sem, K_MSEC(wait_ms));
+
+                uint32_t wake_cycles = k_cycle_get_32();
+                atomic_val_t events = atomic_clear(&radio_stage.wake_events);
+                radio_stage.heartbeat = k_uptime_get_32();
+                wait_ms = RADIO_FALLBACK_DELAY_MS;
+
+                // Re-init here rather than on the UI work queue - it would race the publish below
+                if (atomic_clear(&radio_stage.reset_requested))
+                {
+                        LOG_ERR("ESB FROZEN - Attempting reset...");
+                        // A plain re-init is skipped while the driver is flagged initialized
+                        if (esb_comm_reset() == ESB_COMM_STATUS_NOT_INITIALIZED)
+                        {
+                                esb_comm_init();
+                        }
+                        continue;
+                }
+
+                // Peripherals are going down or coming back - nothing to send
+                if (power_mgmt_get_state() != POWER_STATE_ACTIVE)
+                {
+                        continue;
+                }
+
+                if (events & RADIO_WAKE_SLOT)
+                {
+                        radio_stage.slot_wakes++;
+                }
+                if (events & RADIO_WAKE_URGENT)
+                {
+                        radio_stage.urgent_wakes++;
+                }
+
+                update_controller_data();
+                uint32_t update_us = k_cyc_to_us_floor32(k_cycle_get_32() - wake_cycles);
+                radio_stage.update_max_us = MAX(radio_stage.update_max_us, update_us);
+
+                esb_controller_data_t snapshot;
+                k_spinlock_key_t key = k_spin_lock(&controller_data_lock);
+                snapshot = controller_data;
+                k_spin_unlock(&controller_data_lock, key);
+
+                esb_comm_status_t status = send_controller_data(&snapshot);
+                radio_stage.last_status = status;
+                radio_stage.publishes++;
+                radio_stage.errors = (status == ESB_COMM_STATUS_OK) ? 0 : radio_stage.errors + 1;
+
+                uint32_t done_cycles = k_cycle_get_32();
+                uint32_t publish_us = k_cyc_to_us_floor32(done_cycles - wake_cycles);
+                radio_stage.publish_max_us = MAX(radio_stage.publish_max_us, publish_us);
+                if (events & RADIO_WAKE_SLOT)
+                {
+                        // A shrinking margin means RADIO_SAMPLE_LEAD_US no longer covers the sample path
+                        int32_t margin_us = (int32_t)(radio_stage.next_slot_us - esb_comm_local_time_us());
+                        radio_stage.slot_margin_min_us = MIN(radio_stage.slot_margin_min_us, margin_us);
+                }
+
+                if (esb_comm_is_slot_timer_active())
+                {
+                        consecutive_busy_count = 0;
+                        continue;
+                }
+
+                // Fallback pacing: dongle-requested delay from the ACK payload (limited to reasonable range)
+                uint16_t next_delay = esb_comm_get_next_delay();
+                if (next_delay > 0 && next_delay <= 100)
+                {
+                        wait_ms = next_delay;
+                }
+
+                // Radio busy backoff - 2ms extra per consecutive busy publish, capped at 10ms
+                if (status == ESB_COMM_STATUS_BUSY)
+                {
+                        consecutive_busy_count++;
+                        uint16_t backoff_delay = MIN(consecutive_busy_count * 2, 10);
+                        wait_ms += backoff_delay;
+
+                        if (consecutive_busy_count <= 3)
+                        { // Don't spam logs
+                                LOG_WRN("RADIO BUSY - adding %dms backoff (consecutive: %d)",
+                                        backoff_delay, consecutive_busy_count);
+                        }
+                }
+                else
+                {
+                        consecutive_busy_count = 0;
+                }
+        }
+}
+
 // Thread stacks
+K_THREAD_STACK_DEFINE(radio_thread_stack, RADIO_STAGE_STACK_SIZE);
 K_THREAD_STACK_DEFINE(trackpad_thread_stack, 1024);
 K_THREAD_STACK_DEFINE(display_thread_stack, 1024);
 
 // Thread control blocks
+static struct k_thread radio_thread_data;
 static struct k_thread trackpad_thread_data;
 static struct k_thread display_thread_data;
 
@@ -468,7 +607,7 @@ bool init_trackpad_arduino_hybrid(void)
 
         // Test a simple coordinate read to make sure it works
         uint8_t coord_data[8];
-        int ret = i2c_write_read(i2c_dev, 0x56, "\x10", 1, coord_data, 8);
+        int ret = i2c_bus_write_read(I2C_BUS_CLIENT_TRACKPAD, 0x56, "\x10", 1, coord_data, 8);
         if (ret == 0)
         {
                 // Variables used to verify read worked, but values not logged
@@ -485,14 +624,33 @@ bool init_trackpad_arduino_hybrid(void)
         return true;
 }
 
-// Simple coordinate reading function with precise I2C timing diagnostics
-bool read_trackpad_coordinates_simple(uint16_t *x, uint16_t *y)
+// One IQS7211E RDY cycle: gestures (0x0E) through finger 2 area (0x17) in a single burst
+#define IQS7211E_FRAME_START_REG 0x0E
+#define IQS7211E_FRAME_WORDS     10
+
+typedef struct
+{
+        uint16_t gestures;         // 0x0E: taps/hold/palm (low byte), swipes (high byte)
+        uint16_t info_flags;       // 0x0F: finger count (bits 8-9), too many fingers (bit 12)
+        uint16_t finger1_x;        // 0x10
+        uint16_t finger1_y;        // 0x11
+        uint16_t finger1_strength; // 0x12
+        uint16_t finger1_area;     // 0x13
+        uint16_t finger2_x;        // 0x14
+        uint16_t finger2_y;        // 0x15
+        uint16_t finger2_strength; // 0x16
+        uint16_t finger2_area;     // 0x17
+} trackpad_frame_t;
+
+// Read a complete touch frame with precise I2C timing diagnostics
+bool read_trackpad_frame(trackpad_frame_t *frame)
 {
         // Use cycle counter for microsecond precision timing
         uint32_t cycles_start = k_cycle_get_32();
 
-        uint8_t coord_data[8];
-        int ret = i2c_write_read(i2c_dev, 0x56, "\x10", 1, coord_data, 8);
+        uint8_t reg = IQS7211E_FRAME_START_REG;
+        uint8_t raw[IQS7211E_FRAME_WORDS * 2];
+        int ret = i2c_bus_write_read(I2C_BUS_CLIENT_TRACKPAD, 0x56, &reg, 1, raw, sizeof(raw));
 
         uint32_t cycles_end = k_cycle_get_32();
         uint32_t cycles_elapsed = cycles_end - cycles_start;
@@ -508,14 +666,93 @@ bool read_trackpad_coordinates_simple(uint16_t *x, uint16_t *y)
                 last_warning = k_uptime_get_32();
         }
 
-        if (ret == 0)
+        if (ret != 0)
+        {
+                return false;
+        }
+
+        // Registers are consecutive little-endian words in struct order
+        uint16_t *words = (uint16_t *)frame;
+        for (int i = 0; i < IQS7211E_FRAME_WORDS; i++)
         {
-                *x = coord_data[0] | (coord_data[1] << 8);
-                *y = coord_data[2] | (coord_data[3] << 8);
-                return true;
+                words[i] = sys_get_le16(&raw[i * 2]);
         }
+        return true;
+}
+
+// First gesture flagged in a frame as an iqs7211e_gestures_e code, IQS7211E_GESTURE_NONE if none
+static uint8_t trackpad_gesture_code(uint16_t gestures)
+{
+        // Low byte bits 0-4 = single tap..palm, high byte bits 0-7 = swipes - codes are consecutive
+        uint16_t events = (gestures & 0x001F) | ((gestures & 0xFF00) >> 3);
+
+        return events ? (uint8_t)(__builtin_ctz(events) + IQS7211E_GESTURE_SINGLE_TAP) : IQS7211E_GESTURE_NONE;
+}
+
+// Touch strength squeezed into one byte for the radio (saturating)
+static uint8_t trackpad_strength_byte(uint16_t strength)
+{
+        return (uint8_t)MIN(strength >> 4, UINT8_MAX);
+}
+
+// Publish a frame into controller_data - finger 1 keeps padX/padY, the rest goes in the touch fields
+void apply_trackpad_frame(const trackpad_frame_t *frame)
+{
+        static uint8_t gesture_count = 0;
+        static uint8_t last_gesture = IQS7211E_GESTURE_NONE;
+
+        uint8_t fingers = (frame->info_flags >> 8) & 0x03;
+        bool finger1_valid = fingers >= 1 && frame->finger1_x != 0xFFFF && frame->finger1_y != 0xFFFF &&
+                             (frame->finger1_x != 0 || frame->finger1_y != 0);
+        bool finger2_valid = fingers >= 2 && frame->finger2_x != 0xFFFF && frame->finger2_y != 0xFFFF;
+
+        // Gestures are one-frame events - latch the latest one and count it so a lost packet can't hide it
+        uint8_t gesture = trackpad_gesture_code(frame->gestures);
+        if (gesture != IQS7211E_GESTURE_NONE)
+        {
+                last_gesture = gesture;
+                gesture_count++;
+        }
+
+        if (finger1_valid)
+        {
+                // Check for haptic feedback before updating controller data
+                check_trackpad_haptic_feedback(frame->finger1_x, frame->finger1_y);
+        }
+        else
+        {
+                trackpad_detent_reset();
+                finger2_valid = false;
+        }
+
+        // The whole frame lands in one snapshot - never finger 1 of this frame with finger 2 of the last
+        k_spinlock_key_t key = k_spin_lock(&controller_data_lock);
+        controller_data.padX = finger1_valid ? frame->finger1_x : 0;
+        controller_data.padY = finger1_valid ? frame->finger1_y : 0;
+        controller_data.padStrength = finger1_valid ? trackpad_strength_byte(frame->finger1_strength) : 0;
+        controller_data.pad2X = finger2_valid ? frame->finger2_x : 0;
+        controller_data.pad2Y = finger2_valid ? frame->finger2_y : 0;
+        controller_data.pad2Strength = finger2_valid ? trackpad_strength_byte(frame->finger2_strength) : 0;
+        controller_data.touch = (last_gesture & ESB_TOUCH_GESTURE_MASK) |
+                                ((finger2_valid ? 2 : finger1_valid ? 1 : 0) << ESB_TOUCH_FINGERS_SHIFT) |
+                                ((gesture_count << ESB_TOUCH_COUNT_SHIFT) & ESB_TOUCH_COUNT_MASK);
+        k_spin_unlock(&controller_data_lock, key);
+}
+
+// Clear all trackpad fields (read failure or no data)
+void clear_trackpad_data(void)
+{
+        trackpad_detent_reset();
 
-        return false;
+        k_spinlock_key_t key = k_spin_lock(&controller_data_lock);
+        controller_data.padX = 0;
+        controller_data.padY = 0;
+        controller_data.padStrength = 0;
+        controller_data.pad2X = 0;
+        controller_data.pad2Y = 0;
+        controller_data.pad2Strength = 0;
+        controller_data.touch &= ~ESB_TOUCH_FINGERS_MASK; // Keep the latched gesture and its count
+        k_spin_unlock(&controller_data_lock, key);
 }
 
 // Add this to your main.c - minimal direct trackpad init
@@ -525,7 +762,7 @@ bool init_trackpad_minimal(void)
 
         // Test I2C communication first
         uint8_t test_data;
-        int ret = i2c_read(i2c_dev, &test_data, 1, 0x56);
+        int ret = i2c_bus_read(I2C_BUS_CLIENT_TRACKPAD, &test_data, 1, 0x56);
         if (ret != 0)
         {
                 LOG_ERR("Trackpad not responding at 0x56: %d", ret);
@@ -537,7 +774,7 @@ bool init_trackpad_minimal(void)
 
         // 1. Read product number to verify device
         uint8_t prod_data[2];
-        ret = i2c_write_read(i2c_dev, 0x56, "\x00", 1, prod_data, 2); // Read from 0x00
+        ret = i2c_bus_write_read(I2C_BUS_CLIENT_TRACKPAD, 0x56, "\x00", 1, prod_data, 2); // Read from 0x00
         if (ret != 0)
         {
                 LOG_ERR("Failed to read product number: %d", ret);
@@ -556,7 +793,7 @@ bool init_trackpad_minimal(void)
         // 2. Software reset
         LOG_INF("Performing software reset...");
         uint8_t reset_cmd[] = {0x34, 0x02}; // Write 0x02 to address 0x34 (SW_RESET_BIT)
-        ret = i2c_write(i2c_dev, reset_cmd, sizeof(reset_cmd), 0x56);
+        ret = i2c_bus_write(I2C_BUS_CLIENT_TRACKPAD, reset_cmd, sizeof(reset_cmd), 0x56);
         if (ret != 0)
         {
                 LOG_ERR("Software reset failed: %d", ret);
@@ -572,7 +809,7 @@ bool init_trackpad_minimal(void)
         // ALP Compensation (0x1F-0x20)
         uint8_t alp_comp[] = {0x1F, ALP_COMPENSATION_A_0, ALP_COMPENSATION_A_1,
                               ALP_COMPENSATION_B_0, ALP_COMPENSATION_B_1};
-        ret = i2c_write(i2c_dev, alp_comp, sizeof(alp_comp), 0x56);
+        ret = i2c_bus_write(I2C_BUS_CLIENT_TRACKPAD, alp_comp, sizeof(alp_comp), 0x56);
         if (ret != 0)
                 LOG_WRN("ALP compensation write failed: %d", ret);
 
@@ -586,7 +823,7 @@ bool init_trackpad_minimal(void)
             ALP_ATI_MULTIPLIERS_DIVIDERS_0, ALP_ATI_MULTIPLIERS_DIVIDERS_1,
             ALP_COMPENSATION_DIV, ALP_LTA_DRIFT_LIMIT,
             ALP_ATI_TARGET_0, ALP_ATI_TARGET_1};
-        ret = i2c_write(i2c_dev, ati_settings, sizeof(ati_settings), 0x56);
+        ret = i2c_bus_write(I2C_BUS_CLIENT_TRACKPAD, ati_settings, sizeof(ati_settings), 0x56);
         if (ret != 0)
                 LOG_WRN("ATI settings write failed: %d", ret);
 
@@ -606,7 +843,7 @@ bool init_trackpad_minimal(void)
             LP1_MODE_TIMEOUT_0, LP1_MODE_TIMEOUT_1,
             REATI_RETRY_TIME, REF_UPDATE_TIME,
             I2C_TIMEOUT_0, I2C_TIMEOUT_1};
-        ret = i2c_write(i2c_dev, report_rates, sizeof(report_rates), 0x56);
+        ret = i2c_bus_write(I2C_BUS_CLIENT_TRACKPAD, report_rates, sizeof(report_rates), 0x56);
         if (ret != 0)
                 LOG_WRN("Report rates write failed: %d", ret);
 
@@ -617,7 +854,7 @@ bool init_trackpad_minimal(void)
             SYSTEM_CONTROL_0, SYSTEM_CONTROL_1,
             CONFIG_SETTINGS0, CONFIG_SETTINGS1,
             OTHER_SETTINGS_0, OTHER_SETTINGS_1};
-        ret = i2c_write(i2c_dev, sys_control, sizeof(sys_control), 0x56);
+        ret = i2c_bus_write(I2C_BUS_CLIENT_TRACKPAD, sys_control, sizeof(sys_control), 0x56);
         if (ret != 0)
         {
                 LOG_ERR("System control write failed: %d", ret);
@@ -632,7 +869,7 @@ bool init_trackpad_minimal(void)
         // 4. Acknowledge reset
         LOG_INF("Acknowledging reset...");
         uint8_t ack_reset[] = {0x33, SYSTEM_CONTROL_0 | 0x80}; // Set ACK_RESET_BIT
-        ret = i2c_write(i2c_dev, ack_reset, sizeof(ack_reset), 0x56);
+        ret = i2c_bus_write(I2C_BUS_CLIENT_TRACKPAD, ack_reset, sizeof(ack_reset), 0x56);
         if (ret != 0)
         {
                 LOG_ERR("Reset acknowledge failed: %d", ret);
@@ -642,7 +879,7 @@ bool init_trackpad_minimal(void)
         // 5. Start ATI
         LOG_INF("Starting ATI...");
         uint8_t start_ati[] = {0x33, SYSTEM_CONTROL_0 | 0x20}; // Set TP_RE_ATI_BIT
-        ret = i2c_write(i2c_dev, start_ati, sizeof(start_ati), 0x56);
+        ret = i2c_bus_write(I2C_BUS_CLIENT_TRACKPAD, start_ati, sizeof(start_ati), 0x56);
         if (ret != 0)
         {
                 LOG_ERR("ATI start failed: %d", ret);
@@ -657,7 +894,7 @@ bool init_trackpad_minimal(void)
         while ((k_uptime_get_32() - ati_start) < 5000)
         { // 5 second timeout
                 uint8_t info_flags[2];
-                ret = i2c_write_read(i2c_dev, 0x56, "\x0F", 1, info_flags, 2); // Read INFO_FLAGS
+                ret = i2c_bus_write_read(I2C_BUS_CLIENT_TRACKPAD, 0x56, "\x0F", 1, info_flags, 2); // Read INFO_FLAGS
                 if (ret == 0)
                 {
                         if (info_flags[0] & 0x10)
@@ -680,7 +917,7 @@ bool init_trackpad_minimal(void)
         // 7. Set event mode
         LOG_INF("Setting event mode...");
         uint8_t event_mode[] = {0x35, CONFIG_SETTINGS0, CONFIG_SETTINGS1 | 0x01}; // Set EVENT_MODE_BIT
-        ret = i2c_write(i2c_dev, event_mode, sizeof(event_mode), 0x56);
+        ret = i2c_bus_write(I2C_BUS_CLIENT_TRACKPAD, event_mode, sizeof(event_mode), 0x56);
         if (ret != 0)
         {
                 LOG_WRN("Event mode set failed: %d", ret);
@@ -699,7 +936,7 @@ bool init_trackpad_enhanced(void)
 
         // Test I2C communication first
         uint8_t test_data;
-        int ret = i2c_read(i2c_dev, &test_data, 1, 0x56);
+        int ret = i2c_bus_read(I2C_BUS_CLIENT_TRACKPAD, &test_data, 1, 0x56);
         if (ret != 0)
         {
                 LOG_ERR("Trackpad not responding at 0x56: %d", ret);
@@ -711,7 +948,7 @@ bool init_trackpad_enhanced(void)
 
         // 1. Read product number to verify device
         uint8_t prod_data[2];
-        ret = i2c_write_read(i2c_dev, 0x56, "\x00", 1, prod_data, 2);
+        ret = i2c_bus_write_read(I2C_BUS_CLIENT_TRACKPAD, 0x56, "\x00", 1, prod_data, 2);
         if (ret != 0)
         {
                 LOG_ERR("Failed to read product number: %d", ret);
@@ -730,7 +967,7 @@ bool init_trackpad_enhanced(void)
         // 2. Software reset - CORRECT ADDRESS
         LOG_INF("Performing software reset...");
         uint8_t reset_cmd[] = {0x51, 0x02}; // Write to SYSTEM_CONTROL_1, SW_RESET_BIT
-        ret = i2c_write(i2c_dev, reset_cmd, sizeof(reset_cmd), 0x56);
+        ret = i2c_bus_write(I2C_BUS_CLIENT_TRACKPAD, reset_cmd, sizeof(reset_cmd), 0x56);
         if (ret != 0)
         {
                 LOG_ERR("Software reset failed: %d", ret);
@@ -747,7 +984,7 @@ bool init_trackpad_enhanced(void)
         do                                                                                               \
         {                                                                                                \
                 uint8_t cmd[] = {addr, value};                                                           \
-                int result = i2c_write(i2c_dev, cmd, 2, 0x56);                                           \
+                int result = i2c_bus_write(I2C_BUS_CLIENT_TRACKPAD, cmd, 2, 0x56);                       \
                 if (result != 0)                                                                         \
                 {                                                                                        \
                         LOG_ERR("Failed to write %s (0x%02X to 0x%02X): %d", desc, value, addr, result); \
@@ -835,7 +1072,7 @@ bool init_trackpad_enhanced(void)
         while ((k_uptime_get_32() - ati_start) < 3000)
         { // 3 second timeout (reduced from 10s to prevent long freezes)
                 uint8_t info_flags[2];
-                ret = i2c_write_read(i2c_dev, 0x56, "\x0F", 1, info_flags, 2);
+                ret = i2c_bus_write_read(I2C_BUS_CLIENT_TRACKPAD, 0x56, "\x0F", 1, info_flags, 2);
                 if (ret == 0)
                 {
                         if (info_flags[0] & 0x10)
@@ -864,10 +1101,6 @@ bool init_trackpad_enhanced(void)
         return true;
 }
 
-// Global haptic pulse management variables (moved from function-local)
-static uint32_t haptic_pulse_start = 0;
-static bool haptic_pulse_active = false;
-
 // Trackpad RDY interrupt handler
 void trackpad_rdy_interrupt_handler(const struct device *dev, struct gpio_callback *cb, uint32_t pins)
 {
@@ -892,51 +1125,127 @@ void trackpad_rdy_interrupt_handler(const struct device *dev, struct gpio_callba
         k_sem_give(&trackpad_rdy_sem);
 }
 
-// Add this function to trigger haptic via GPIO pin
+// Trackpad detents (raw trackpad units, the pad spans about 0-1919)
+#define DETENT_SPACING_MIN              80      // Travel between ticks for a slow finger
+#define DETENT_SPACING_MAX              320     // Spacing cap for fast swipes
+#define DETENT_SPACING_PER_KSPEED       40      // Extra spacing per 1000 units/s of finger speed
+#define DETENT_LEVEL_MAX                0x7F    // RTP tick strength for a slow finger
+#define DETENT_LEVEL_MIN                0x30    // Strength floor for fast swipes
+#define DETENT_LEVEL_SPEED_FLOOR        6000    // Finger speed (units/s) where strength reaches the floor
+#define DETENT_PULSE_US                 10000   // RTP tick length, about two LRA cycles
+#define DETENT_MIN_INTERVAL_US          20000   // Ticks closer than this blur into a buzz
+#define DETENT_NOISE_UNITS              3       // Per-frame moves below this are sensor jitter
+#define DETENT_SPEED_ALPHA_Q8           64      // EMA weight of a new speed sample
+#define DETENT_SPEED_GAP_US             100000  // Frame gap that restarts the speed estimate
+#define DETENT_SPEED_MAX                100000  // Clamp for single-frame jumps (keeps the EMA in 32 bits)
+
+static struct
+{
+        bool tracking;          // Finger down and last_x/last_y valid
+        uint16_t last_x;
+        uint16_t last_y;
+        uint32_t last_cyc;      // Cycle time of last_x/last_y
+        uint32_t last_detent_cyc;
+        uint32_t travel;        // Travel since the last tick
+        uint32_t speed;         // Smoothed speed, units per second
+} detent_state;
+
+// Integer square root (floor) for detent travel
+static uint32_t detent_isqrt(uint32_t value)
+{
+        uint32_t root = 0;
+        uint32_t bit = 1UL << 30;
+
+        while (bit > value)
+        {
+                bit >>= 2;
+        }
+        while (bit != 0)
+        {
+                if (value >= root + bit)
+                {
+                        value -= root + bit;
+                        root = (root >> 1) + bit;
+                }
+                else
+                {
+                        root >>= 1;
+                }
+                bit >>= 2;
+        }
+        return root;
+}
+
+// Forget the finger so the next touch starts a fresh detent track
+void trackpad_detent_reset(void)
+{
+        detent_state.tracking = false;
+}
+
+// Trackpad detent engine - fires a short RTP tick every DETENT_SPACING of finger travel.
+// Spacing widens and ticks soften as the finger speeds up, so slow moves click crisply
+// and fast swipes roll smoothly without flooding the motor. The haptic work queue ends each tick.
 void check_trackpad_haptic_feedback(uint16_t new_x, uint16_t new_y)
 {
-        static uint16_t last_x = 0;
-        static uint16_t last_y = 0;
-        static bool first_read = true;
+        uint32_t now_cyc = k_cycle_get_32();
+
+        // Skip haptic on first read of a touch
+        if (!detent_state.tracking)
+        {
+                detent_state.last_x = new_x;
+                detent_state.last_y = new_y;
+                detent_state.last_cyc = now_cyc;
+                detent_state.last_detent_cyc = now_cyc - k_us_to_cyc_ceil32(DETENT_MIN_INTERVAL_US);
+                detent_state.travel = 0;
+                detent_state.speed = 0;
+                detent_state.tracking = true;
+                return;
+        }
+
+        // Euclidean step since the last frame - sensor jitter on a resting finger is not travel
+        int32_t dx = (int32_t)new_x - (int32_t)detent_state.last_x;
+        int32_t dy = (int32_t)new_y - (int32_t)detent_state.last_y;
+        uint32_t step = detent_isqrt((uint32_t)(dx * dx + dy * dy));
+        uint32_t dt_us = k_cyc_to_us_floor32(now_cyc - detent_state.last_cyc);
 
-        // Skip haptic on first read
-        if (first_read)
+        if (step < DETENT_NOISE_UNITS || dt_us == 0)
         {
-                last_x = new_x;
-                last_y = new_y;
-                first_read = false;
                 return;
         }
+        detent_state.last_x = new_x;
+        detent_state.last_y = new_y;
+        detent_state.last_cyc = now_cyc;
 
-        // Calculate distance moved
-        int16_t x_diff = abs((int16_t)new_x - (int16_t)last_x);
-        int16_t y_diff = abs((int16_t)new_y - (int16_t)last_y);
+        // Smoothed finger speed in units per second (a long gap restarts the estimate)
+        uint32_t speed = 0;
+        if (dt_us < DETENT_SPEED_GAP_US)
+        {
+                speed = (uint32_t)MIN(((uint64_t)step * 1000000U) / dt_us, DETENT_SPEED_MAX);
+        }
+        detent_state.speed = (detent_state.speed * (256 - DETENT_SPEED_ALPHA_Q8) + speed * DETENT_SPEED_ALPHA_Q8) >> 8;
 
-        // Check if movement exceeds threshold (120 units in either direction)
-        if (x_diff >= 120 || y_diff >= 120)
+        uint32_t spacing = MIN(DETENT_SPACING_MIN + detent_state.speed * DETENT_SPACING_PER_KSPEED / 1000,
+                               DETENT_SPACING_MAX);
+        detent_state.travel += step;
+        if (detent_state.travel < spacing)
         {
-                if (!haptic_pulse_active)
-                {
-                        // Start haptic pulse
-                        gpio_pin_set_dt(&haptic_trigger, 1);
-                        haptic_pulse_start = k_uptime_get_32();
-                        haptic_pulse_active = true;
+                return;
+        }
 
-                        // Update last position
-                        last_x = new_x;
-                        last_y = new_y;
-                }
+        // One tick per frame at most - a long jump keeps only the partial detent
+        detent_state.travel %= spacing;
+        if (k_cyc_to_us_floor32(now_cyc - detent_state.last_detent_cyc) < DETENT_MIN_INTERVAL_US)
+        {
+                return;
         }
-}
 
-// Separate function to handle haptic pulse completion - called every trackpad thread loop
-void update_haptic_pulse_state(void)
-{
-        // Handle haptic pulse completion (called every trackpad thread iteration)
-        if (haptic_pulse_active && (k_uptime_get_32() - haptic_pulse_start) >= 1) // 1ms pulse
+        uint32_t softening = MIN(detent_state.speed, DETENT_LEVEL_SPEED_FLOOR) *
+                             (DETENT_LEVEL_MAX - DETENT_LEVEL_MIN) / DETENT_LEVEL_SPEED_FLOOR;
+        const haptic_step_t tick = HAPTIC_STEP_RTP_US(DETENT_LEVEL_MAX - softening, DETENT_PULSE_US);
+
+        if (haptic_play_sequence(&tick, 1, HAPTIC_PRIORITY_FEEDBACK) == 0)
         {
-                gpio_pin_set_dt(&haptic_trigger, 0);
-                haptic_pulse_active = false;
+                detent_state.last_detent_cyc = now_cyc;
         }
 }
 
@@ -1000,52 +1309,32 @@ void trackpad_thread_entry(void *p1, void *p2, void *p3)
                 // Update thread heartbeat for monitoring
                 trackpad_thread_heartbeat = k_uptime_get_32();
 
-                // Update haptic pulse state every loop iteration (ensures pulse completion)
-                update_haptic_pulse_state();
-
                 // Wait for RDY interrupt (blocks until data is ready)
                 if (k_sem_take(&trackpad_rdy_sem, K_MSEC(100)) == 0)
                 {
                         k_usleep(50);
-                        // RDY interrupt occurred - data is ready
-                        uint16_t x, y;
+                        // RDY interrupt occurred - the whole frame is read in one burst
+                        trackpad_frame_t frame;
 
-                        if (read_trackpad_coordinates_simple(&x, &y))
+                        if (read_trackpad_frame(&frame))
                         {
-                                // DEBUG: Always log the raw trackpad values
-                                LOG_INF("TRACKPAD RAW: X=%u (0x%04X), Y=%u (0x%04X)", x, x, y, y);
-                                
-                                // Check for valid coordinates
-                                if (x != 0xFFFF && y != 0xFFFF && (x != 0 || y != 0))
-                                {
-                                        LOG_INF("  -> VALID: Setting controller padX=%u, padY=%u", x, y);
-                                        // Check for haptic feedback before updating controller data
-                                        check_trackpad_haptic_feedback(x, y);
-
-                                        controller_data.padX = x;
-                                        controller_data.padY = y;
-                                }
-                                else
-                                {
-                                        LOG_INF("  -> INVALID: Clearing to 0,0");
-                                        controller_data.padX = 0;
-                                        controller_data.padY = 0;
-                                }
+                                LOG_DBG("TRACKPAD: fingers=%u F1=%u,%u F2=%u,%u gestures=0x%04X",
+                                        (frame.info_flags >> 8) & 0x03, frame.finger1_x, frame.finger1_y,
+                                        frame.finger2_x, frame.finger2_y, frame.gestures);
+                                apply_trackpad_frame(&frame);
                         }
                         else
                         {
                                 LOG_ERR("  -> I2C READ FAILED");
-                                // I2C read failed - set coordinates to 0
-                                controller_data.padX = 0;
-                                controller_data.padY = 0;
+                                // I2C read failed - clear the touch
+                                clear_trackpad_data();
                         }
                 }
                 else
                 {
                         LOG_DBG("TRACKPAD: Timeout (no interrupt)");
                         // Timeout - no interrupt in 100ms, consider no touch
-                        controller_data.padX = 0;
-                        controller_data.padY = 0;
+                        clear_trackpad_data();
                 }
         }
 
@@ -1058,33 +1347,16 @@ polling_mode:
                 // Update thread heartbeat for monitoring
                 trackpad_thread_heartbeat = k_uptime_get_32();
 
-                // Update haptic pulse state every loop iteration (ensures pulse completion)
-                update_haptic_pulse_state();
-
-                uint16_t x, y;
+                trackpad_frame_t frame;
 
-                if (read_trackpad_coordinates_simple(&x, &y))
+                if (read_trackpad_frame(&frame))
                 {
-                        // Check for valid coordinates
-                        if (x != 0xFFFF && y != 0xFFFF && (x != 0 || y != 0))
-                        {
-                                // Check for haptic feedback before updating controller data
-                                check_trackpad_haptic_feedback(x, y);
-
-                                controller_data.padX = x;
-                                controller_data.padY = y;
-                        }
-                        else
-                        {
-                                controller_data.padX = 0;
-                                controller_data.padY = 0;
-                        }
+                        apply_trackpad_frame(&frame);
                 }
                 else
                 {
-                        // I2C read failed - set coordinates to 0
-                        controller_data.padX = 0;
-                        controller_data.padY = 0;
+                        // I2C read failed - clear the touch
+                        clear_trackpad_data();
                 }
 
                 k_sleep(K_MSEC(11)); // 60Hz polling - thread will be scheduled properly
@@ -1171,6 +1443,16 @@ void display_set_screen(display_screen_type_t screen_type, void *data)
         // No mutex unlock needed
 }
 
+// Button edge (interrupt context) - urgent change, wake the radio stage so the next slot carries it
+static void button_changed_handler(uint16_t pressed_mask, uint32_t edge_cycles)
+{
+        ARG_UNUSED(pressed_mask);
+        ARG_UNUSED(edge_cycles);
+
+        atomic_or(&radio_stage.wake_events, RADIO_WAKE_URGENT);
+        k_sem_give(&radio_wake_sem);
+}
+
 // Initialize all controller buttons using button driver library
 void buttons_init(void)
 {
@@ -1196,6 +1478,8 @@ void buttons_init(void)
                 return;
         }
 
+        button_driver_register_change_callback(button_changed_handler);
+
         LOG_INF("Button driver initialized successfully with haptic feedback");
 }
 
@@ -1224,7 +1508,15 @@ void adc_init(void)
 
         LOG_INF("Analog driver initialized successfully - StickX(P0.02), StickY(P0.03), Trigger(P0.28) ready");
 
-        // Start the ADC reading thread
+        // Timer-triggered DMA scanning; fall back to the polling thread if the hardware can't be claimed
+        status = analog_driver_start_dma_scan();
+        if (status == ANALOG_STATUS_OK)
+        {
+                LOG_INF("ADC DMA scan started successfully");
+                return;
+        }
+
+        LOG_WRN("ADC DMA scan unavailable (%d), using ADC thread", status);
         status = analog_driver_start_thread();
         if (status != ANALOG_STATUS_OK)
         {
@@ -1258,16 +1550,16 @@ void read_button_inputs(void)
                 // Trigger haptic on trackpad click press or release (rising and falling edge)
                 if (current_pad_click != last_pad_click_state && haptic_is_available())
                 {
-                        gpio_pin_set_dt(&haptic_trigger, 1);
-                        k_sleep(K_USEC(100));
-                        gpio_pin_set_dt(&haptic_trigger, 0);
+                        haptic_play_pulses(1, 100, 0, HAPTIC_PRIORITY_FEEDBACK);
                         LOG_DBG("Trackpad click haptic triggered");
                 }
 
                 last_pad_click_state = current_pad_click;
                 // Update controller data structure
+                k_spinlock_key_t key = k_spin_lock(&controller_data_lock);
                 controller_data.buttons = button_data.buttons;
-                controller_data.flags |= (button_data.flags & 0x7F); // Merge flags (preserve other bits)
+                controller_data.flags = (controller_data.flags & 0x80) | (button_data.flags & 0x7F); // Keep the controller ID bit
+                k_spin_unlock(&controller_data_lock, key);
         }
 }
 
@@ -1280,9 +1572,11 @@ void read_analog_inputs(void)
         if (status == ANALOG_STATUS_OK)
         {
                 // Update controller data structure directly
+                k_spinlock_key_t key = k_spin_lock(&controller_data_lock);
                 controller_data.stickX = analog_data.stick_x;
                 controller_data.stickY = analog_data.stick_y;
                 controller_data.trigger = analog_data.trigger;
+                k_spin_unlock(&controller_data_lock, key);
         }
 }
 
@@ -1375,48 +1669,101 @@ void calibrate_analog_inputs(void)
         }
 }
 
-// Read IMU sensor data using imu_driver library
+// Take IMU samples published by the imu_driver reader thread - never waits on I2C
+// With no new sample since the last call the previous accel/gyro stay in place
 void read_imu_inputs(void)
 {
-        // First read raw data to ensure filter is initialized
-        imu_raw_data_t raw_data;
-        int raw_ret = imu_read_raw_data(&raw_data);
+        imu_timed_sample_t samples[IMU_FIFO_MAX_SAMPLES];
+        esb_imu_sample_t batch[IMU_FIFO_MAX_SAMPLES];
+        int count;
+
+        // Copy everything published since the last loop; the last sample is the packet's current accel/gyro
+        while ((count = imu_get_samples(samples, ARRAY_SIZE(samples))) > 0)
+        {
+                for (int i = 0; i < count; i++)
+                {
+                        batch[i].accelX = samples[i].data.accel_x;
+                        batch[i].accelY = samples[i].data.accel_y;
+                        batch[i].accelZ = samples[i].data.accel_z;
+                        batch[i].gyroX = samples[i].data.gyro_x;
+                        batch[i].gyroY = samples[i].data.gyro_y;
+                        batch[i].gyroZ = samples[i].data.gyro_z;
+                }
+
+                // Batched samples only go on the wire when the sensor FIFO keeps every sample
+                if (imu_fifo_is_enabled())
+                {
+                        esb_comm_queue_imu_samples(batch, count);
+                }
+
+                k_spinlock_key_t key = k_spin_lock(&controller_data_lock);
+                controller_data.accelX = batch[count - 1].accelX;
+                controller_data.accelY = batch[count - 1].accelY;
+                controller_data.accelZ = batch[count - 1].accelZ;
+                controller_data.gyroX = batch[count - 1].gyroX;
+                controller_data.gyroY = batch[count - 1].gyroY;
+                controller_data.gyroZ = batch[count - 1].gyroZ;
+                k_spin_unlock(&controller_data_lock, key);
+        }
 
-        if (raw_ret != 0)
+        if (count < 0)
         {
-                // Set to zero on read error
+                // Reader not running - set to zero
+                k_spinlock_key_t key = k_spin_lock(&controller_data_lock);
                 controller_data.accelX = 0;
                 controller_data.accelY = 0;
                 controller_data.accelZ = 0;
                 controller_data.gyroX = 0;
                 controller_data.gyroY = 0;
                 controller_data.gyroZ = 0;
+                k_spin_unlock(&controller_data_lock, key);
+        }
+}
+
+// Write the online gyro bias estimate to flash when it has moved, at most every 10 minutes
+void save_gyro_bias_if_changed(uint32_t now)
+{
+        static uint32_t last_seen_updates = 0;
+        static uint32_t last_save_time = 0;
+        static bool saved_once = false;
+
+        uint32_t updates = imu_get_bias_update_count();
+        if (!imu_is_available() || updates == last_seen_updates)
+        {
                 return;
         }
 
-        // Now get the processed controller data
-        imu_controller_data_t imu_data;
-        int ret = imu_get_controller_data(&imu_data);
+        if (saved_once && (now - last_save_time) < GYRO_BIAS_SAVE_MIN_INTERVAL_MS)
+        {
+                return; // Retried at the next check - the estimate keeps improving meanwhile
+        }
+        last_seen_updates = updates;
 
-        if (ret == 0)
+        int16_t bias[3];
+        if (imu_get_gyro_bias_mdps(bias) != 0)
         {
-                // Copy data to controller structure
-                controller_data.accelX = imu_data.accel_x;
-                controller_data.accelY = imu_data.accel_y;
-                controller_data.accelZ = imu_data.accel_z;
-                controller_data.gyroX = imu_data.gyro_x;
-                controller_data.gyroY = imu_data.gyro_y;
-                controller_data.gyroZ = imu_data.gyro_z;
+                return;
         }
-        else
+
+        bool changed = !controller_calibration.imu_calibrated ||
+                       abs(bias[0] - controller_calibration.gyro_offset_x) > GYRO_BIAS_SAVE_THRESHOLD_MDPS ||
+                       abs(bias[1] - controller_calibration.gyro_offset_y) > GYRO_BIAS_SAVE_THRESHOLD_MDPS ||
+                       abs(bias[2] - controller_calibration.gyro_offset_z) > GYRO_BIAS_SAVE_THRESHOLD_MDPS;
+        if (!changed)
         {
-                // Set to zero on error
-                controller_data.accelX = 0;
-                controller_data.accelY = 0;
-                controller_data.accelZ = 0;
-                controller_data.gyroX = 0;
-                controller_data.gyroY = 0;
-                controller_data.gyroZ = 0;
+                return;
+        }
+
+        controller_calibration.gyro_offset_x = bias[0];
+        controller_calibration.gyro_offset_y = bias[1];
+        controller_calibration.gyro_offset_z = bias[2];
+        controller_calibration.imu_calibrated = true;
+
+        if (controller_storage_save_calibration(&controller_calibration) == 0)
+        {
+                LOG_INF("Gyro bias saved: %d, %d, %d mdps", bias[0], bias[1], bias[2]);
+                last_save_time = now;
+                saved_once = true;
         }
 }
 
@@ -1429,6 +1776,9 @@ void shutdown_all_peripherals(void)
         // Turn off LED
         gpio_pin_set_dt(&led0, 0);
 
+        // Button edges stop here - the wake button is armed for System OFF by power management
+        button_driver_set_interrupts(false);
+
         // Shutdown display completely
         display_set_blanking(true);
         LOG_INF("Display blanked");
@@ -1439,7 +1789,7 @@ void shutdown_all_peripherals(void)
         {
                 // SSD1306 power off command sequence
                 uint8_t power_off_cmd[] = {0x00, 0xAE};                   // Command mode, Display OFF
-                int ret = i2c_write(display_i2c, power_off_cmd, 2, 0x3C); // SSD1306 address
+                int ret = i2c_bus_write(I2C_BUS_CLIENT_DISPLAY, power_off_cmd, 2, 0x3C); // SSD1306 address
                 if (ret == 0)
                 {
                         LOG_INF("Display powered down via I2C command");
@@ -1451,7 +1801,7 @@ void shutdown_all_peripherals(void)
 
                 // SSD1306 charge pump off command sequence
                 uint8_t charge_pump_off_cmd[] = {0x00, 0x8D, 0x10};              // Command mode, Charge Pump OFF
-                int ret2 = i2c_write(display_i2c, charge_pump_off_cmd, 3, 0x3C); // SSD1306 address
+                int ret2 = i2c_bus_write(I2C_BUS_CLIENT_DISPLAY, charge_pump_off_cmd, 3, 0x3C); // SSD1306 address
                 if (ret2 == 0)
                 {
                         LOG_INF("Display charge pump powered down via I2C command");
@@ -1482,6 +1832,7 @@ void shutdown_all_peripherals(void)
         if (imu_is_available())
         {
                 LOG_INF("DEBUG: About to put IMU in standby");
+                imu_stop_reader_thread();
                 imu_enter_standby();
                 LOG_INF("IMU powered down");
         }
@@ -1499,6 +1850,10 @@ void shutdown_all_peripherals(void)
                 LOG_INF("ESB communication stopped for sleep");
         }
 
+        // Stop sampling before suspending the ADC - the DMA scan's TIMER3/TIMER4 would keep running at 2 kHz
+        analog_driver_stop_dma_scan();
+        analog_driver_stop_thread();
+
         // Power down ADC to save power
         const struct device *adc_dev = DEVICE_DT_GET(DT_NODELABEL(adc));
         if (device_is_ready(adc_dev))
@@ -1557,6 +1912,10 @@ void wakeup_all_peripherals(void)
         // Turn on status LED to indicate system is awake
         gpio_pin_set_dt(&led0, 1);
 
+        // Re-arm button edges and resync the debounced levels with the pins
+        button_driver_set_interrupts(true);
+        button_driver_reset();
+
         // Resume I2C buses first to restore communication
         const struct device *i2c0_dev = DEVICE_DT_GET(DT_NODELABEL(i2c0));
         const struct device *i2c1_dev = DEVICE_DT_GET(DT_NODELABEL(i2c1));
@@ -1609,6 +1968,7 @@ void wakeup_all_peripherals(void)
         LOG_INF("Restoring saved configuration from storage...");
         controller_storage_load_calibration(&controller_calibration);
         controller_storage_load_bindings(&controller_bindings);
+        button_driver_set_map(controller_bindings.button_map);
         controller_storage_load_preferences(&controller_preferences);
 
         // Re-enable display
@@ -1625,6 +1985,8 @@ void wakeup_all_peripherals(void)
                         LOG_WRN("Failed to power up display: %d", disp_ret);
                 }
         }
+        // Panel RAM isn't trusted after power down - the next refresh rewrites the whole frame
+        display_invalidate();
         display_set_blanking(false);
         LOG_INF("Display reactivated");
 
@@ -1648,15 +2010,14 @@ void wakeup_all_peripherals(void)
         {
                 haptic_wakeup();
 
-                // Play a wake-up effect to confirm system is active
-                k_sleep(K_MSEC(100)); // Small delay for haptic to wake up
-                for (int i = 0; i < 2; i++)
-                {
-                        gpio_pin_set_dt(&haptic_trigger, 1);
-                        k_sleep(K_MSEC(50));
-                        gpio_pin_set_dt(&haptic_trigger, 0);
-                        k_sleep(K_MSEC(50));
-                }
+                // Play a wake-up effect to confirm system is active, after a small delay for haptic to wake up
+                const haptic_step_t wake_steps[] = {
+                        HAPTIC_STEP_PAUSE_US(100000),
+                        HAPTIC_STEP_PULSE_US(50000),
+                        HAPTIC_STEP_PAUSE_US(50000),
+                        HAPTIC_STEP_PULSE_US(50000)
+                };
+                haptic_play_sequence(wake_steps, ARRAY_SIZE(wake_steps), HAPTIC_PRIORITY_ALERT);
                 LOG_INF("Haptic driver awakened with wake-up feedback");
         }
 
@@ -1664,6 +2025,7 @@ void wakeup_all_peripherals(void)
         if (imu_is_available())
         {
                 imu_wakeup();
+                imu_start_reader_thread();
                 LOG_INF("IMU reactivated");
         }
 
@@ -1712,48 +2074,552 @@ void ui_handle_input(void)
         }
 }
 
-int main(void)
-{
-        int ret;
+// UI work queue - combos, calibration, health checks and stats logging. Runs below the radio
+// stage and every producer, so a slow item (calibration, flash writes) only delays other UI items
+#define UI_WORKQ_STACK_SIZE     2048
+#define UI_WORKQ_PRIORITY       11      // Below the ADC fallback thread (10)
+#define UI_TICK_MS              10      // Combo hold timing resolution
 
-        LOG_INF("Zephyr ESB Controller Starting...");
+K_THREAD_STACK_DEFINE(ui_workq_stack, UI_WORKQ_STACK_SIZE);
+static struct k_work_q ui_workq;
+static struct k_work_delayable ui_tick_work;
 
-        // Initialize LED
-        if (!gpio_is_ready_dt(&led0))
+// Heartbeat, battery voltage and gyro bias persistence
+static void ui_tick_housekeeping(uint32_t current_time)
+{
+        static uint32_t tick_counter = 0;
+        tick_counter++;
+
+        // UI heartbeat - log every 30 seconds to track work queue health
+        static uint32_t last_ui_heartbeat = 0;
+        if ((current_time - last_ui_heartbeat) > 30000)
         {
-                LOG_ERR("LED device not ready");
-                return -ENODEV;
+                LOG_INF("UI heartbeat: tick %u, uptime %ums", tick_counter, current_time);
+                last_ui_heartbeat = current_time;
         }
-        gpio_pin_configure_dt(&led0, GPIO_OUTPUT_INACTIVE);
 
-        // Initialize battery voltage divider (XIAO nRF52840 safe approach)
-        if (!gpio_is_ready_dt(&vbat_enable))
+        // Battery voltage monitoring - check every 10 seconds
+        static uint32_t last_battery_read = 0;
+        if ((current_time - last_battery_read) > 10000)
         {
-                LOG_ERR("VBAT enable GPIO not ready");
-                return -ENODEV;
-        }
+                uint16_t battery_mv = 0;
+                if (analog_driver_get_battery_voltage(&battery_mv) == ANALOG_STATUS_OK)
+                {
+                        LOG_INF("Battery: %u mV", battery_mv);
+                }
+                else
+                {
+                        LOG_WRN("Failed to read battery voltage");
+                }
 
-        // Try different GPIO configuration approaches for P0.14
-        LOG_INF("Attempting to configure P0.14 as current sink for voltage divider control...");
+                last_battery_read = current_time;
+        }
 
-        // Method 1: Open-drain output (proper current sink)
-        ret = gpio_pin_configure_dt(&vbat_enable, GPIO_OUTPUT_INACTIVE | GPIO_OPEN_DRAIN);
-        if (ret != 0)
+        // Gyro bias persistence - the driver re-estimates it whenever the controller is still
+        static uint32_t last_bias_check = 0;
+        if ((current_time - last_bias_check) > GYRO_BIAS_CHECK_INTERVAL_MS)
         {
-                LOG_ERR("Failed to configure P0.14 as open-drain: %d", ret);
+                save_gyro_bias_if_changed(current_time);
+                last_bias_check = current_time;
         }
+}
 
-        ret = gpio_pin_set_dt(&vbat_enable, 0); // Active LOW for current sink
-        if (ret != 0)
+// Button combos: analog debug (MODE), calibration (stick + pad click), sleep (Start + Bumper)
+static void ui_tick_combos(uint32_t current_time)
+{
+        // Custom sleep combo detection: Start + Bumper for 5 seconds
+        static uint32_t sleep_combo_start = 0;
+        static bool sleep_combo_active = false;
+        static uint32_t last_haptic_time = 0;
+        static bool sleep_confirm_started = false;
+        static bool sleep_in_progress = false;
+
+        bool start_pressed = gpio_pin_get_dt(&start);   // Start button
+        bool bumper_pressed = gpio_pin_get_dt(&bumper); // Bumper button
+
+        // Skip combo detection if sleep is already in progress
+        if (sleep_in_progress)
         {
-                LOG_ERR("Failed to set P0.14 to 0: %d", ret);
+                LOG_DBG("Sleep in progress - skipping combo detection");
+                return;
         }
 
-        // Method 2: If open-drain not supported, try standard output with pull-down
-        if (ret != 0)
+        // Analog debug mode: Hold MODE button to print analog values
+        static bool analog_debug_mode = false;
+        static uint32_t last_analog_debug = 0;
+        bool mode_pressed = gpio_pin_get_dt(&mode_button); // MODE button
+
+        if (mode_pressed && !start_pressed && !bumper_pressed)
         {
-                ret = gpio_pin_configure_dt(&vbat_enable, GPIO_OUTPUT | GPIO_PULL_DOWN);
-                if (ret == 0)
+                if (!analog_debug_mode)
+                {
+                        analog_debug_mode = true;
+                        printk("\n*** ANALOG DEBUG MODE ACTIVATED ***\n");
+                }
+
+                // Update analog data for display (thread-safe)
+                analog_controller_data_t analog_data;
+                analog_driver_get_controller_data(&analog_data);
+
+                display_analog_data_t display_data = {
+                    .stick_x = analog_data.stick_x,
+                    .stick_y = analog_data.stick_y,
+                    .trigger = analog_data.trigger};
+
+                display_set_screen(DISPLAY_SCREEN_ANALOG, &display_data);
+
+                // Print to console every 200ms
+                if (current_time - last_analog_debug > 200)
+                {
+                        print_analog_values();
+                        last_analog_debug = current_time;
+                }
+        }
+        else if (analog_debug_mode)
+        {
+                analog_debug_mode = false;
+                printk("\n*** ANALOG DEBUG MODE DEACTIVATED ***\n");
+                // Return to status screen (thread-safe)
+                display_set_screen(DISPLAY_SCREEN_STATUS, NULL);
+        }
+
+        // Calibration mode: Hold STICK_CLICK + PAD_CLICK for 3 seconds
+        static bool calibration_combo_active = false;
+        static uint32_t calibration_combo_start = 0;
+        static bool calibration_in_progress = false;
+        bool stick_click_pressed = gpio_pin_get_dt(&stick_click);
+        bool pad_click_pressed = gpio_pin_get_dt(&pad_click);
+
+        if (stick_click_pressed && pad_click_pressed && !calibration_combo_active && !sleep_combo_active && !calibration_in_progress)
+        {
+                calibration_combo_start = k_uptime_get_32();
+                calibration_combo_active = true;
+                LOG_INF(">>> CALIBRATION COMBO DETECTED <<<");
+                LOG_INF(">>> KEEP HOLDING BOTH BUTTONS FOR 3 SECONDS <<<");
+
+                // Haptic feedback to indicate combo started
+                if (haptic_is_available())
+                {
+                        haptic_play_pulses(1, 100, 0, HAPTIC_PRIORITY_ALERT);
+                }
+        }
+        else if ((!stick_click_pressed || !pad_click_pressed) && calibration_combo_active && !calibration_in_progress)
+        {
+                LOG_INF("Calibration combo cancelled (buttons released too early)");
+                calibration_combo_active = false;
+        }
+
+        if (calibration_combo_active && !calibration_in_progress)
+        {
+                uint32_t hold_time = k_uptime_get_32() - calibration_combo_start;
+
+                // Haptic feedback every second with progress message
+                static uint32_t last_cal_haptic = 0;
+                uint32_t seconds_held = hold_time / 1000;
+                if (seconds_held > 0 && (seconds_held * 1000) > last_cal_haptic && haptic_is_available())
+                {
+                        haptic_play_pulses(1, 50, 0, HAPTIC_PRIORITY_ALERT);
+                        last_cal_haptic = seconds_held * 1000;
+                        LOG_INF(">>> HOLD PROGRESS: %u/3 seconds <<<", seconds_held);
+                }
+
+                if (hold_time >= 3000)
+                { // 3 seconds - start calibration
+                        LOG_INF("=== STARTING INTERACTIVE CALIBRATION ===");
+                        calibration_combo_active = false;
+                        calibration_in_progress = true;  // Mark calibration as active
+
+                        // Triple haptic to confirm
+                        if (haptic_is_available())
+                        {
+                                haptic_play_pulses(3, 100000, 100000, HAPTIC_PRIORITY_ALERT);
+                        }
+
+                        // Switch to calibration display
+                        calibration_phase = 0;
+                        calibration_progress = 0;
+                        display_set_screen(DISPLAY_SCREEN_CALIBRATION, NULL);
+                        k_sleep(K_MSEC(100));  // Give display thread time to switch
+
+                        LOG_INF(">>> CALIBRATION STARTING - 10 SECONDS <<<");
+                        LOG_INF(">>> CENTER THE STICK - DO NOT TOUCH <<<");
+                        
+                        // Begin calibration collection
+                        analog_driver_begin_calibration_collection();
+                        
+                        // Collect calibration data with visual feedback
+                        uint32_t cal_start = k_uptime_get_32();
+                        uint32_t cal_duration = 10000; // 10 seconds total
+                        bool gave_movement_instruction = false;
+                        
+                        while ((k_uptime_get_32() - cal_start) < cal_duration)
+                        {
+                                // Calculate progress
+                                uint32_t elapsed = k_uptime_get_32() - cal_start;
+                                calibration_progress = (elapsed * 100) / cal_duration;
+                                
+                                // Update phase at 2 seconds
+                                if (elapsed >= 2000 && !gave_movement_instruction) {
+                                        calibration_phase = 1;
+                                        LOG_INF(">>> MOVE STICK IN CIRCLES & PULL TRIGGER <<<");
+                                        gave_movement_instruction = true;
+                                }
+                                
+                                // Update calibration data
+                                analog_driver_update_calibration_data();
+                                
+                                k_sleep(K_MSEC(20)); // 50Hz update
+                        }
+                        
+                        // Finalize calibration
+                        analog_status_t cal_status = analog_driver_finalize_calibration();
+
+                                if (cal_status == ANALOG_STATUS_OK)
+                                {
+                                        LOG_INF("Calibration successful - saving to flash...");
+
+                                        // Get calibration data from analog driver
+                                        analog_calibration_t stick_x_cal, stick_y_cal, trigger_cal;
+
+                                        if (analog_driver_get_calibration(ANALOG_CHANNEL_STICK_X, &stick_x_cal) == ANALOG_STATUS_OK)
+                                        {
+                                                controller_calibration.stick_center_x = stick_x_cal.center_value;
+                                                controller_calibration.stick_min_x = stick_x_cal.min_value;
+                                                controller_calibration.stick_max_x = stick_x_cal.max_value;
+                                                controller_calibration.stick_deadzone = stick_x_cal.deadzone;
+                                                
+                                                LOG_INF("Stick X: center=%d, min=%d, max=%d, deadzone=%d",
+                                                        stick_x_cal.center_value, stick_x_cal.min_value,
+                                                        stick_x_cal.max_value, stick_x_cal.deadzone);
+                                        }
+
+                                        if (analog_driver_get_calibration(ANALOG_CHANNEL_STICK_Y, &stick_y_cal) == ANALOG_STATUS_OK)
+                                        {
+                                                controller_calibration.stick_center_y = stick_y_cal.center_value;
+                                                controller_calibration.stick_min_y = stick_y_cal.min_value;
+                                                controller_calibration.stick_max_y = stick_y_cal.max_value;
+                                                
+                                                LOG_INF("Stick Y: center=%d, min=%d, max=%d",
+                                                        stick_y_cal.center_value, stick_y_cal.min_value,
+                                                        stick_y_cal.max_value);
+                                        }
+
+                                        if (analog_driver_get_calibration(ANALOG_CHANNEL_TRIGGER, &trigger_cal) == ANALOG_STATUS_OK)
+                                        {
+                                                controller_calibration.trigger_min = trigger_cal.min_value;
+                                                controller_calibration.trigger_max = trigger_cal.max_value;
+                                                
+                                                LOG_INF("Trigger: min=%d, max=%d",
+                                                        trigger_cal.min_value, trigger_cal.max_value);
+                                        }
+
+                                        controller_calibration.stick_calibrated = true;
+                                        controller_calibration.trigger_calibrated = true;
+
+                                        // Save to flash
+                                        int save_ret = controller_storage_save_calibration(&controller_calibration);
+                                        if (save_ret == 0)
+                                        {
+                                                LOG_INF("✓ Calibration saved to flash successfully!");
+
+                                                // Success haptic pattern (long buzz)
+                                                if (haptic_is_available())
+                                                {
+                                                        haptic_play_pulses(1, 500000, 0, HAPTIC_PRIORITY_ALERT);
+                                                }
+                                        }
+                                        else
+                                        {
+                                                LOG_ERR("✗ Failed to save calibration to flash: %d", save_ret);
+
+                                                // Error haptic pattern (fast buzzes)
+                                                if (haptic_is_available())
+                                                {
+                                                        haptic_play_pulses(5, 50000, 50000, HAPTIC_PRIORITY_ALERT);
+                                                }
+                                        }
+                                }
+                                else
+                                {
+                                        LOG_ERR("Calibration failed: %d", cal_status);
+                                }
+                        
+                        // Return to status screen and mark calibration complete
+                        calibration_in_progress = false;
+                        display_set_screen(DISPLAY_SCREEN_STATUS, NULL);
+                        LOG_INF("=== CALIBRATION MODE EXITED ===");
+                }
+        }
+
+        if (start_pressed && bumper_pressed && !sleep_combo_active)
+        {
+                sleep_combo_start = k_uptime_get_32();
+                sleep_combo_active = true;
+                last_haptic_time = 0; // Reset haptic timing
+                LOG_INF("Sleep combo detected (Start+Bumper) - hold for 5 seconds...");
+
+                // Haptic feedback to indicate combo started
+                if (haptic_is_available())
+                {
+                        haptic_play_pulses(1, 100, 0, HAPTIC_PRIORITY_ALERT);
+                }
+        }
+        else if (!start_pressed || !bumper_pressed)
+        {
+                if (sleep_combo_active)
+                {
+                        LOG_INF("Sleep combo cancelled");
+                }
+                sleep_combo_active = false;
+                last_haptic_time = 0; // Reset haptic timing when cancelled
+                sleep_confirm_started = false;
+        }
+
+        if (sleep_combo_active)
+        {
+                uint32_t hold_time = k_uptime_get_32() - sleep_combo_start;
+
+                // Give haptic feedback every second during hold (non-blocking)
+                uint32_t seconds_held = hold_time / 1000;
+                uint32_t expected_haptic_time = seconds_held * 1000;
+
+                if (seconds_held > 0 && expected_haptic_time > last_haptic_time && haptic_is_available())
+                {
+                        haptic_play_pulses(1, 50000, 0, HAPTIC_PRIORITY_ALERT);
+                        last_haptic_time = expected_haptic_time;
+                }
+
+                if (hold_time >= 5000)
+                { // 5 seconds
+                        // Triple vibrate to confirm sleep, then sleep once it has played out
+                        if (!sleep_confirm_started)
+                        {
+                                sleep_confirm_started = true;
+                                if (haptic_is_available())
+                                {
+                                        haptic_play_pulses(3, 100000, 100000, HAPTIC_PRIORITY_ALERT);
+                                }
+                        }
+                        else if (!haptic_is_playing())
+                        {
+                                // Proceed to sleep after triple vibration
+                                LOG_INF("Entering sleep mode!");
+                                sleep_combo_active = false;
+                                last_haptic_time = 0;
+                                sleep_confirm_started = false; // Reset for next time
+
+                                // Set sleep in progress immediately
+                                sleep_in_progress = true;
+
+                                // Enter sleep mode directly
+                                power_mgmt_enter_sleep();
+
+                                // System will resume here after wake-up
+                                LOG_INF("Woke up from sleep mode!");
+                                sleep_in_progress = false;
+                                return;
+                        }
+                }
+        }
+}
+
+// Monitor thread health and system resources (every 5 seconds)
+static void ui_tick_health(uint32_t now)
+{
+        static uint32_t last_health_check = 0;
+        if ((now - last_health_check) <= 5000)
+        {
+                return;
+        }
+
+        uint32_t radio_age = now - radio_stage.heartbeat;
+        uint32_t trackpad_age = now - trackpad_thread_heartbeat;
+        uint32_t display_age = now - display_thread_heartbeat;
+
+        if (radio_age > 100)
+        { // Radio stage wakes every slot or every fallback period at most
+                LOG_WRN("Radio stage appears stalled (heartbeat %ums old)", radio_age);
+        }
+        if (trackpad_age > 2000)
+        { // More than 2 seconds old
+                LOG_WRN("Trackpad thread appears frozen (heartbeat %ums old)", trackpad_age);
+        }
+        if (display_age > 2000)
+        {
+                LOG_WRN("Display thread appears frozen (heartbeat %ums old)", display_age);
+        }
+
+        // Add system resource monitoring
+        LOG_INF("System health: radio=%ums, trackpad=%ums, display=%ums, uptime=%ums",
+                radio_age, trackpad_age, display_age, now);
+
+        last_health_check = now;
+}
+
+// Radio stage and ESB statistics (every 5 seconds), ESB watchdog and timing summary
+static void ui_tick_radio_stats(uint32_t now)
+{
+        static uint32_t last_tx_debug = 0;
+        static uint32_t last_publishes = 0;
+        if ((now - last_tx_debug) > 5000)
+        {
+                esb_controller_data_t snapshot;
+                k_spinlock_key_t key = k_spin_lock(&controller_data_lock);
+                snapshot = controller_data;
+                k_spin_unlock(&controller_data_lock, key);
+
+                uint32_t publishes = radio_stage.publishes;
+
+                // Get ESB statistics to see if radio is actually working
+                esb_comm_stats_t esb_stats = {0};
+                esb_comm_status_t stats_status = esb_comm_get_stats(&esb_stats);
+
+                if (stats_status == ESB_COMM_STATUS_OK)
+                {
+                        // ESB Watchdog: Detect when stats stop incrementing despite "successful" sends
+                        static uint32_t last_total_transmissions = 0;
+                        static uint32_t watchdog_counter = 0;
+
+                        if (esb_stats.total_transmissions == last_total_transmissions)
+                        {
+                                watchdog_counter++;
+                                LOG_WRN("ESB Watchdog: Stats frozen for %u periods (total: %u)",
+                                        watchdog_counter, esb_stats.total_transmissions);
+
+                                // Reset ESB if stats haven't changed for 3 periods (15 seconds) - the radio stage
+                                // owns the driver, so it does the re-init on its next wake
+                                if (watchdog_counter >= 3)
+                                {
+                                        atomic_set(&radio_stage.reset_requested, 1);
+                                        k_sem_give(&radio_wake_sem);
+                                        watchdog_counter = 0;
+                                        last_total_transmissions = 0; // Reset tracking
+                                }
+                        }
+                        else
+                        {
+                                // Stats are incrementing normally
+                                watchdog_counter = 0;
+                                last_total_transmissions = esb_stats.total_transmissions;
+                        }
+
+                        LOG_INF("TX Debug: %u publishes (%u slot, %u urgent wakes), status: %d, trigger: %d, sticks: %d,%d, errors: %u",
+                                publishes - last_publishes, radio_stage.slot_wakes, radio_stage.urgent_wakes,
+                                radio_stage.last_status, snapshot.trigger, snapshot.stickX, snapshot.stickY,
+                                radio_stage.errors);
+                        LOG_INF("ESB Stats: total: %u, success: %u, failed: %u, rate: %.1f%%, last_ok: %s",
+                                esb_stats.total_transmissions, esb_stats.successful_transmissions,
+                                esb_stats.failed_transmissions, esb_stats.success_rate * 100.0f,
+                                esb_stats.last_tx_succeeded ? "yes" : "no");
+                        LOG_INF("Rumble: %u updates, host->ACK latency last=%uus max=%uus",
+                                esb_stats.rumble_updates, esb_stats.rumble_latency_us,
+                                esb_stats.rumble_latency_max_us);
+                        LOG_INF("Sample age at TX: last=%uus max=%uus, stale slots: %u",
+                                esb_stats.sample_age_us, esb_stats.sample_age_max_us,
+                                esb_stats.sample_stale);
+
+                        // Check for data corruption - log full controller data structure
+                        LOG_INF("Data Check: flags=0x%02X, buttons=0x%02X, padX=%d, padY=%d",
+                                snapshot.flags, snapshot.buttons, snapshot.padX, snapshot.padY);
+                        LOG_INF("Data Check: accelX=%d, accelY=%d, accelZ=%d",
+                                snapshot.accelX, snapshot.accelY, snapshot.accelZ);
+
+                        // Corruption detection: Check for impossible values
+                        bool corruption_detected = false;
+                        if (snapshot.stickX < -127 || snapshot.stickX > 127)
+                                corruption_detected = true;
+                        if (snapshot.stickY < -127 || snapshot.stickY > 127)
+                                corruption_detected = true;
+                        if (snapshot.trigger > 255)
+                                corruption_detected = true;
+                        if (abs(snapshot.padX) > 32767 || abs(snapshot.padY) > 32767)
+                                corruption_detected = true;
+
+                        if (corruption_detected)
+                        {
+                                LOG_ERR("DATA CORRUPTION DETECTED! Stick/trigger values out of range");
+                        }
+                }
+                else
+                {
+                        LOG_ERR("Failed to get ESB stats: %d", stats_status);
+                }
+                last_tx_debug = now;
+                last_publishes = publishes;
+        }
+
+        // Periodic summary every 10 seconds
+        static uint32_t last_summary = 0;
+        if ((now - last_summary) > 10000)
+        {
+                LOG_INF("TIMING SUMMARY - Update:%dus, Publish:%dus, Slot margin min:%dus",
+                        radio_stage.update_max_us, radio_stage.publish_max_us,
+                        radio_stage.slot_margin_min_us);
+                last_summary = now;
+                // Reset extremes for next period
+                radio_stage.update_max_us = 0;
+                radio_stage.publish_max_us = 0;
+                radio_stage.slot_margin_min_us = INT32_MAX;
+        }
+}
+
+// One UI tick - reschedules itself, so a long item pushes the next tick instead of stacking them
+static void ui_tick_work_handler(struct k_work *work)
+{
+        ARG_UNUSED(work);
+
+        uint32_t now = k_uptime_get_32();
+
+        ui_tick_housekeeping(now);
+        ui_tick_combos(now);
+        ui_tick_health(k_uptime_get_32());
+        ui_tick_radio_stats(k_uptime_get_32());
+
+        k_work_reschedule_for_queue(&ui_workq, &ui_tick_work, K_MSEC(UI_TICK_MS));
+}
+
+int main(void)
+{
+        int ret;
+
+        LOG_INF("Zephyr ESB Controller Starting...");
+
+        // Initialize LED
+        if (!gpio_is_ready_dt(&led0))
+        {
+                LOG_ERR("LED device not ready");
+                return -ENODEV;
+        }
+        gpio_pin_configure_dt(&led0, GPIO_OUTPUT_INACTIVE);
+
+        // Initialize battery voltage divider (XIAO nRF52840 safe approach)
+        if (!gpio_is_ready_dt(&vbat_enable))
+        {
+                LOG_ERR("VBAT enable GPIO not ready");
+                return -ENODEV;
+        }
+
+        // Try different GPIO configuration approaches for P0.14
+        LOG_INF("Attempting to configure P0.14 as current sink for voltage divider control...");
+
+        // Method 1: Open-drain output (proper current sink)
+        ret = gpio_pin_configure_dt(&vbat_enable, GPIO_OUTPUT_INACTIVE | GPIO_OPEN_DRAIN);
+        if (ret != 0)
+        {
+                LOG_ERR("Failed to configure P0.14 as open-drain: %d", ret);
+        }
+
+        ret = gpio_pin_set_dt(&vbat_enable, 0); // Active LOW for current sink
+        if (ret != 0)
+        {
+                LOG_ERR("Failed to set P0.14 to 0: %d", ret);
+        }
+
+        // Method 2: If open-drain not supported, try standard output with pull-down
+        if (ret != 0)
+        {
+                ret = gpio_pin_configure_dt(&vbat_enable, GPIO_OUTPUT | GPIO_PULL_DOWN);
+                if (ret == 0)
                 {
                         ret = gpio_pin_set_dt(&vbat_enable, 0);
                         int pin_state = gpio_pin_get_dt(&vbat_enable);
@@ -1802,6 +2668,13 @@ int main(void)
         // Initialize I2C for trackpad (when connected) - MOVED TO LATER
         i2c_dev = DEVICE_DT_GET(DT_NODELABEL(i2c1));
 
+        // Every i2c1 client (trackpad, display, haptics) goes through the bus scheduler
+        ret = i2c_bus_init();
+        if (ret != 0)
+        {
+                LOG_ERR("I2C1 bus scheduler init failed: %d", ret);
+        }
+
         // Get I2C0 for IMU
         const struct device *imu_i2c_dev = DEVICE_DT_GET(DT_NODELABEL(i2c0));
         if (!device_is_ready(imu_i2c_dev))
@@ -1855,10 +2728,11 @@ int main(void)
                 else
                 {
                         // Test haptic motor with a quick pulse to verify it's working
-                        k_sleep(K_MSEC(50));
-                        gpio_pin_set_dt(&haptic_trigger, 1);
-                        k_sleep(K_MSEC(50));
-                        gpio_pin_set_dt(&haptic_trigger, 0);
+                        const haptic_step_t test_steps[] = {
+                                HAPTIC_STEP_PAUSE_US(50000),
+                                HAPTIC_STEP_PULSE_US(50000)
+                        };
+                        haptic_play_sequence(test_steps, ARRAY_SIZE(test_steps), HAPTIC_PRIORITY_ALERT);
                         LOG_INF("Haptic motor test pulse sent");
                 }
         }
@@ -1880,6 +2754,9 @@ int main(void)
                 LOG_WRN("Power management initialization failed: %d", pm_status);
         }
 
+        // Power management reconfigured the MODE pin as its wake button - re-arm the button edges
+        button_driver_set_interrupts(true);
+
         // Register power management callbacks for peripheral control
         power_mgmt_register_shutdown_callback(shutdown_all_peripherals);
         power_mgmt_register_wakeup_callback(wakeup_all_peripherals);
@@ -1902,6 +2779,7 @@ int main(void)
                 // Load configuration from flash
                 controller_storage_load_calibration(&controller_calibration);
                 controller_storage_load_bindings(&controller_bindings);
+                button_driver_set_map(controller_bindings.button_map);
                 controller_storage_load_preferences(&controller_preferences);
                 
                 // Debug: Show what was loaded from flash
@@ -1997,6 +2875,22 @@ int main(void)
         else
         {
                 LOG_INF("IMU driver initialized successfully");
+
+                // Gyro offsets in storage are the last online bias estimate (mdps, sensor frame)
+                if (controller_calibration.imu_calibrated)
+                {
+                        int16_t bias[3] = {controller_calibration.gyro_offset_x,
+                                           controller_calibration.gyro_offset_y,
+                                           controller_calibration.gyro_offset_z};
+                        imu_set_gyro_bias_mdps(bias);
+                }
+
+                // All IMU I2C traffic moves to the reader thread from here on
+                ret = imu_start_reader_thread();
+                if (ret != 0)
+                {
+                        LOG_WRN("IMU reader thread failed to start: %d", ret);
+                }
         }
 
         // Initialize controller data with proper ID
@@ -2038,9 +2932,12 @@ int main(void)
         LOG_INF("Display: %s", (display_get_status() == DISPLAY_STATUS_READY) ? "AVAILABLE" : "NOT AVAILABLE"); // Check actual status
         LOG_INF("Trackpad: Will be initialized on first touch");
 
-        update_controller_data();
-
-        uint32_t loop_counter = 0;
+        // Radio stage first - from here on transmissions only depend on the slot timer
+        k_tid_t radio_tid = k_thread_create(&radio_thread_data, radio_thread_stack,
+                                            K_THREAD_STACK_SIZEOF(radio_thread_stack),
+                                            radio_thread_entry, NULL, NULL, NULL,
+                                            RADIO_STAGE_PRIORITY, 0, K_NO_WAIT); // Priority 4
+        k_thread_name_set(radio_tid, "radio");
 
         // Create trackpad thread
         k_tid_t trackpad_tid = k_thread_create(&trackpad_thread_data, trackpad_thread_stack,
@@ -2058,794 +2955,15 @@ int main(void)
 
         LOG_INF("Trackpad, analog, and display threads created");
 
-        while (true)
-        {
-                loop_counter++;
-
-                // Main loop heartbeat - log every 30 seconds to track main loop health
-                static uint32_t last_main_heartbeat = 0;
-                uint32_t current_time = k_uptime_get_32();
-                if ((current_time - last_main_heartbeat) > 30000)
-                {
-                        LOG_INF("Main loop heartbeat: iteration %u, uptime %ums", loop_counter, current_time);
-                        last_main_heartbeat = current_time;
-                }
-
-                // Battery voltage monitoring - check every 10 seconds
-                static uint32_t last_battery_read = 0;
-                if ((current_time - last_battery_read) > 10000)
-                {
-                        uint16_t battery_mv = 0;
-                        if (analog_driver_get_battery_voltage(&battery_mv) == ANALOG_STATUS_OK)
-                        {
-                                LOG_INF("Battery: %u mV", battery_mv);
-                        }
-                        else
-                        {
-                                LOG_WRN("Failed to read battery voltage");
-                        }
-                        
-                        last_battery_read = current_time;
-                }
-
-                // Custom sleep combo detection: Start + Bumper for 5 seconds
-                static uint32_t sleep_combo_start = 0;
-                static bool sleep_combo_active = false;
-                static uint32_t last_haptic_time = 0;
-                static bool sleep_in_progress = false;
-
-                bool start_pressed = gpio_pin_get_dt(&start);   // Start button
-                bool bumper_pressed = gpio_pin_get_dt(&bumper); // Bumper button
-
-                // Skip combo detection if sleep is already in progress
-                if (sleep_in_progress)
-                {
-                        LOG_DBG("Sleep in progress - skipping combo detection");
-                        k_sleep(K_MSEC(10));
-                        continue;
-                }
-
-                // Debug button states occasionally - removed verbose logging
-                static uint32_t last_button_debug = 0;
-                // Reuse current_time from main heartbeat above
-                if (current_time - last_button_debug > 5000)
-                { // Every 5 seconds
-                        // Removed button state debug logging
-                        last_button_debug = current_time;
-                }
-
-                // Analog debug mode: Hold MODE button to print analog values
-                static bool analog_debug_mode = false;
-                static uint32_t last_analog_debug = 0;
-                bool mode_pressed = gpio_pin_get_dt(&mode_button); // MODE button
-
-                if (mode_pressed && !start_pressed && !bumper_pressed)
-                {
-                        if (!analog_debug_mode)
-                        {
-                                analog_debug_mode = true;
-                                printk("\n*** ANALOG DEBUG MODE ACTIVATED ***\n");
-                        }
-
-                        // Update analog data for display (thread-safe)
-                        analog_controller_data_t analog_data;
-                        analog_driver_get_controller_data(&analog_data);
-
-                        display_analog_data_t display_data = {
-                            .stick_x = analog_data.stick_x,
-                            .stick_y = analog_data.stick_y,
-                            .trigger = analog_data.trigger};
-
-                        display_set_screen(DISPLAY_SCREEN_ANALOG, &display_data);
-
-                        // Print to console every 200ms
-                        if (current_time - last_analog_debug > 200)
-                        {
-                                print_analog_values();
-                                last_analog_debug = current_time;
-                        }
-                }
-                else if (analog_debug_mode)
-                {
-                        analog_debug_mode = false;
-                        printk("\n*** ANALOG DEBUG MODE DEACTIVATED ***\n");
-                        // Return to status screen (thread-safe)
-                        display_set_screen(DISPLAY_SCREEN_STATUS, NULL);
-                }
-
-                // Calibration mode: Hold STICK_CLICK + PAD_CLICK for 3 seconds
-                static bool calibration_combo_active = false;
-                static uint32_t calibration_combo_start = 0;
-                static bool calibration_in_progress = false;
-                bool stick_click_pressed = gpio_pin_get_dt(&stick_click);
-                bool pad_click_pressed = gpio_pin_get_dt(&pad_click);
-
-                if (stick_click_pressed && pad_click_pressed && !calibration_combo_active && !sleep_combo_active && !calibration_in_progress)
-                {
-                        calibration_combo_start = k_uptime_get_32();
-                        calibration_combo_active = true;
-                        LOG_INF(">>> CALIBRATION COMBO DETECTED <<<");
-                        LOG_INF(">>> KEEP HOLDING BOTH BUTTONS FOR 3 SECONDS <<<");
-
-                        // Haptic feedback to indicate combo started
-                        if (haptic_is_available())
-                        {
-                                gpio_pin_set_dt(&haptic_trigger, 1);
-                                k_sleep(K_USEC(100));
-                                gpio_pin_set_dt(&haptic_trigger, 0);
-                        }
-                }
-                else if ((!stick_click_pressed || !pad_click_pressed) && calibration_combo_active && !calibration_in_progress)
-                {
-                        LOG_INF("Calibration combo cancelled (buttons released too early)");
-                        calibration_combo_active = false;
-                }
-
-                if (calibration_combo_active && !calibration_in_progress)
-                {
-                        uint32_t hold_time = k_uptime_get_32() - calibration_combo_start;
-
-                        // Haptic feedback every second with progress message
-                        static uint32_t last_cal_haptic = 0;
-                        uint32_t seconds_held = hold_time / 1000;
-                        if (seconds_held > 0 && (seconds_held * 1000) > last_cal_haptic && haptic_is_available())
-                        {
-                                gpio_pin_set_dt(&haptic_trigger, 1);
-                                k_sleep(K_USEC(50));
-                                gpio_pin_set_dt(&haptic_trigger, 0);
-                                last_cal_haptic = seconds_held * 1000;
-                                LOG_INF(">>> HOLD PROGRESS: %u/3 seconds <<<", seconds_held);
-                        }
-
-                        if (hold_time >= 3000)
-                        { // 3 seconds - start calibration
-                                LOG_INF("=== STARTING INTERACTIVE CALIBRATION ===");
-                                calibration_combo_active = false;
-                                calibration_in_progress = true;  // Mark calibration as active
-
-                                // Triple haptic to confirm
-                                if (haptic_is_available())
-                                {
-                                        for (int i = 0; i < 3; i++)
-                                        {
-                                                gpio_pin_set_dt(&haptic_trigger, 1);
-                                                k_sleep(K_MSEC(100));
-                                                gpio_pin_set_dt(&haptic_trigger, 0);
-                                                k_sleep(K_MSEC(100));
-                                        }
-                                }
-
-                                // Switch to calibration display
-                                calibration_phase = 0;
-                                calibration_progress = 0;
-                                display_set_screen(DISPLAY_SCREEN_CALIBRATION, NULL);
-                                k_sleep(K_MSEC(100));  // Give display thread time to switch
-
-                                LOG_INF(">>> CALIBRATION STARTING - 10 SECONDS <<<");
-                                LOG_INF(">>> CENTER THE STICK - DO NOT TOUCH <<<");
-                                
-                                // Begin calibration collection
-                                analog_driver_begin_calibration_collection();
-                                
-                                // Collect calibration data with visual feedback
-                                uint32_t cal_start = k_uptime_get_32();
-                                uint32_t cal_duration = 10000; // 10 seconds total
-                                bool gave_movement_instruction = false;
-                                
-                                while ((k_uptime_get_32() - cal_start) < cal_duration)
-                                {
-                                        // Calculate progress
-                                        uint32_t elapsed = k_uptime_get_32() - cal_start;
-                                        calibration_progress = (elapsed * 100) / cal_duration;
-                                        
-                                        // Update phase at 2 seconds
-                                        if (elapsed >= 2000 && !gave_movement_instruction) {
-                                                calibration_phase = 1;
-                                                LOG_INF(">>> MOVE STICK IN CIRCLES & PULL TRIGGER <<<");
-                                                gave_movement_instruction = true;
-                                        }
-                                        
-                                        // Update calibration data
-                                        analog_driver_update_calibration_data();
-                                        
-                                        k_sleep(K_MSEC(20)); // 50Hz update
-                                }
-                                
-                                // Finalize calibration
-                                analog_status_t cal_status = analog_driver_finalize_calibration();
-
-                                        if (cal_status == ANALOG_STATUS_OK)
-                                        {
-                                                LOG_INF("Calibration successful - saving to flash...");
-
-                                                // Get calibration data from analog driver
-                                                analog_calibration_t stick_x_cal, stick_y_cal, trigger_cal;
-
-                                                if (analog_driver_get_calibration(ANALOG_CHANNEL_STICK_X, &stick_x_cal) == ANALOG_STATUS_OK)
-                                                {
-                                                        controller_calibration.stick_center_x = stick_x_cal.center_value;
-                                                        controller_calibration.stick_min_x = stick_x_cal.min_value;
-                                                        controller_calibration.stick_max_x = stick_x_cal.max_value;
-                                                        controller_calibration.stick_deadzone = stick_x_cal.deadzone;
-                                                        
-                                                        LOG_INF("Stick X: center=%d, min=%d, max=%d, deadzone=%d",
-                                                                stick_x_cal.center_value, stick_x_cal.min_value,
-                                                                stick_x_cal.max_value, stick_x_cal.deadzone);
-                                                }
-
-                                                if (analog_driver_get_calibration(ANALOG_CHANNEL_STICK_Y, &stick_y_cal) == ANALOG_STATUS_OK)
-                                                {
-                                                        controller_calibration.stick_center_y = stick_y_cal.center_value;
-                                                        controller_calibration.stick_min_y = stick_y_cal.min_value;
-                                                        controller_calibration.stick_max_y = stick_y_cal.max_value;
-                                                        
-                                                        LOG_INF("Stick Y: center=%d, min=%d, max=%d",
-                                                                stick_y_cal.center_value, stick_y_cal.min_value,
-                                                                stick_y_cal.max_value);
-                                                }
-
-                                                if (analog_driver_get_calibration(ANALOG_CHANNEL_TRIGGER, &trigger_cal) == ANALOG_STATUS_OK)
-                                                {
-                                                        controller_calibration.trigger_min = trigger_cal.min_value;
-                                                        controller_calibration.trigger_max = trigger_cal.max_value;
-                                                        
-                                                        LOG_INF("Trigger: min=%d, max=%d",
-                                                                trigger_cal.min_value, trigger_cal.max_value);
-                                                }
-
-                                                controller_calibration.stick_calibrated = true;
-                                                controller_calibration.trigger_calibrated = true;
-
-                                                // Save to flash
-                                                int save_ret = controller_storage_save_calibration(&controller_calibration);
-                                                if (save_ret == 0)
-                                                {
-                                                        LOG_INF("✓ Calibration saved to flash successfully!");
-
-                                                        // Success haptic pattern (long buzz)
-                                                        if (haptic_is_available())
-                                                        {
-                                                                gpio_pin_set_dt(&haptic_trigger, 1);
-                                                                k_sleep(K_MSEC(500));
-                                                                gpio_pin_set_dt(&haptic_trigger, 0);
-                                                        }
-                                                }
-                                                else
-                                                {
-                                                        LOG_ERR("✗ Failed to save calibration to flash: %d", save_ret);
-
-                                                        // Error haptic pattern (fast buzzes)
-                                                        if (haptic_is_available())
-                                                        {
-                                                                for (int i = 0; i < 5; i++)
-                                                                {
-                                                                        gpio_pin_set_dt(&haptic_trigger, 1);
-                                                                        k_sleep(K_MSEC(50));
-                                                                        gpio_pin_set_dt(&haptic_trigger, 0);
-                                                                        k_sleep(K_MSEC(50));
-                                                                }
-                                                        }
-                                                }
-                                        }
-                                        else
-                                        {
-                                                LOG_ERR("Calibration failed: %d", cal_status);
-                                        }
-                                
-                                // Return to status screen and mark calibration complete
-                                calibration_in_progress = false;
-                                display_set_screen(DISPLAY_SCREEN_STATUS, NULL);
-                                LOG_INF("=== CALIBRATION MODE EXITED ===");
-                        }
-                }
-
-                if (start_pressed && bumper_pressed && !sleep_combo_active)
-                {
-                        sleep_combo_start = k_uptime_get_32();
-                        sleep_combo_active = true;
-                        last_haptic_time = 0; // Reset haptic timing
-                        LOG_INF("Sleep combo detected (Start+Bumper) - hold for 5 seconds...");
-
-                        // Haptic feedback to indicate combo started
-                        if (haptic_is_available())
-                        {
-                                gpio_pin_set_dt(&haptic_trigger, 1);
-                                k_sleep(K_USEC(100));
-                                gpio_pin_set_dt(&haptic_trigger, 0);
-                        }
-                }
-                else if (!start_pressed || !bumper_pressed)
-                {
-                        if (sleep_combo_active)
-                        {
-                                LOG_INF("Sleep combo cancelled");
-                        }
-                        sleep_combo_active = false;
-                        last_haptic_time = 0; // Reset haptic timing when cancelled
-                }
-
-                if (sleep_combo_active)
-                {
-                        uint32_t hold_time = k_uptime_get_32() - sleep_combo_start;
-
-                        // Give haptic feedback every second during hold (non-blocking)
-                        uint32_t seconds_held = hold_time / 1000;
-                        uint32_t expected_haptic_time = seconds_held * 1000;
-
-                        // Non-blocking haptic feedback every second during hold
-                        static uint32_t sleep_combo_haptic_start = 0;
-                        static bool sleep_combo_haptic_active = false;
-
-                        if (seconds_held > 0 && expected_haptic_time > last_haptic_time && haptic_is_available())
-                        {
-                                if (!sleep_combo_haptic_active)
-                                {
-                                        gpio_pin_set_dt(&haptic_trigger, 1);
-                                        sleep_combo_haptic_start = k_uptime_get_32();
-                                        sleep_combo_haptic_active = true;
-                                        last_haptic_time = expected_haptic_time;
-                                        // Removed sleep combo haptic debug logging
-                                }
-                        }
-
-                        // Non-blocking haptic pulse completion for sleep combo
-                        if (sleep_combo_haptic_active && (k_uptime_get_32() - sleep_combo_haptic_start) >= 50)
-                        {
-                                gpio_pin_set_dt(&haptic_trigger, 0);
-                                sleep_combo_haptic_active = false;
-                        }
-
-                        if (hold_time >= 5000)
-                        { // 5 seconds
-                                // Non-blocking triple vibrate at 5 seconds to confirm sleep
-                                static uint32_t triple_vibe_start = 0;
-                                static int triple_vibe_stage = 0; // 0=not started, 1-6=vibration stages
-                                static bool triple_vibe_active = false;
-
-                                if (haptic_is_available() && triple_vibe_stage == 0)
-                                {
-                                        // Start triple vibration sequence
-                                        triple_vibe_start = k_uptime_get_32();
-                                        triple_vibe_stage = 1;
-                                        triple_vibe_active = false;
-                                        // Removed sleep combo 5-second debug logging
-                                }
-
-                                // Handle triple vibration stages (non-blocking)
-                                if (triple_vibe_stage > 0)
-                                {
-                                        uint32_t elapsed = k_uptime_get_32() - triple_vibe_start;
-
-                                        switch (triple_vibe_stage)
-                                        {
-                                        case 1: // First vibration on
-                                                if (!triple_vibe_active)
-                                                {
-                                                        gpio_pin_set_dt(&haptic_trigger, 1);
-                                                        triple_vibe_active = true;
-                                                }
-                                                if (elapsed >= 100)
-                                                        triple_vibe_stage = 2; // 100ms on
-                                                break;
-                                        case 2: // First vibration off
-                                                if (triple_vibe_active)
-                                                {
-                                                        gpio_pin_set_dt(&haptic_trigger, 0);
-                                                        triple_vibe_active = false;
-                                                }
-                                                if (elapsed >= 200)
-                                                        triple_vibe_stage = 3; // 100ms off
-                                                break;
-                                        case 3: // Second vibration on
-                                                if (!triple_vibe_active)
-                                                {
-                                                        gpio_pin_set_dt(&haptic_trigger, 1);
-                                                        triple_vibe_active = true;
-                                                }
-                                                if (elapsed >= 300)
-                                                        triple_vibe_stage = 4; // 100ms on
-                                                break;
-                                        case 4: // Second vibration off
-                                                if (triple_vibe_active)
-                                                {
-                                                        gpio_pin_set_dt(&haptic_trigger, 0);
-                                                        triple_vibe_active = false;
-                                                }
-                                                if (elapsed >= 400)
-                                                        triple_vibe_stage = 5; // 100ms off
-                                                break;
-                                        case 5: // Third vibration on
-                                                if (!triple_vibe_active)
-                                                {
-                                                        gpio_pin_set_dt(&haptic_trigger, 1);
-                                                        triple_vibe_active = true;
-                                                }
-                                                if (elapsed >= 500)
-                                                        triple_vibe_stage = 6; // 100ms on
-                                                break;
-                                        case 6: // Third vibration off - sequence complete
-                                                if (triple_vibe_active)
-                                                {
-                                                        gpio_pin_set_dt(&haptic_trigger, 0);
-                                                        triple_vibe_active = false;
-                                                }
-                                                // Proceed to sleep after triple vibration
-                                                LOG_INF("Entering sleep mode!");
-                                                sleep_combo_active = false;
-                                                last_haptic_time = 0;
-                                                triple_vibe_stage = 0; // Reset for next time
-
-                                                // Set sleep in progress immediately
-                                                sleep_in_progress = true;
-
-                                                // Enter sleep mode directly
-                                                power_mgmt_enter_sleep();
-
-                                                // System will resume here after wake-up
-                                                LOG_INF("Woke up from sleep mode!");
-                                                sleep_in_progress = false;
-                                                continue;
-                                        }
-                                }
-                        }
-                }
-
-                // Monitor thread health and system resources (every 5 seconds)
-                static uint32_t last_health_check = 0;
-                uint32_t now = k_uptime_get_32();
-                if ((now - last_health_check) > 5000)
-                {
-                        uint32_t trackpad_age = now - trackpad_thread_heartbeat;
-                        uint32_t display_age = now - display_thread_heartbeat;
-
-                        if (trackpad_age > 2000)
-                        { // More than 2 seconds old
-                                LOG_WRN("Trackpad thread appears frozen (heartbeat %ums old)", trackpad_age);
-                        }
-                        if (display_age > 2000)
-                        {
-                                LOG_WRN("Display thread appears frozen (heartbeat %ums old)", display_age);
-                        }
-
-                        // Add system resource monitoring
-                        LOG_INF("System health: trackpad=%ums, display=%ums, uptime=%ums",
-                                trackpad_age, display_age, now);
-
-                        // Stack monitoring not available in this configuration
-                        // Removed k_thread_stack_space_get calls due to linking issues
-
-                        last_health_check = now;
-                }
-
-                // Get delay from PREVIOUS transmission BEFORE we transmit (transmit will update it)
-                static uint16_t current_sleep_delay = 8; // Start with default
-                uint16_t sleep_delay = current_sleep_delay;
+        // Combos, UI and logging - main() is done after this, every stage runs on its own
+        k_work_queue_init(&ui_workq);
+        k_work_queue_start(&ui_workq, ui_workq_stack, K_THREAD_STACK_SIZEOF(ui_workq_stack),
+                           UI_WORKQ_PRIORITY, NULL);
+        k_thread_name_set(k_work_queue_thread_get(&ui_workq), "ui_workq");
+        k_work_init_delayable(&ui_tick_work, ui_tick_work_handler);
+        k_work_reschedule_for_queue(&ui_workq, &ui_tick_work, K_NO_WAIT);
 
-                // Track when this iteration started
-                uint32_t iteration_start = k_uptime_get_32();
-
-                // Measure ESB transmission time
-                uint32_t tx_start_cycles = k_cycle_get_32();
-
-                // Track actual interval between transmissions
-                static uint32_t last_tx_time = 0;
-                uint32_t tx_time_now = k_uptime_get_32();
-                uint32_t actual_interval = 0;
-                if (last_tx_time > 0) {
-                        actual_interval = tx_time_now - last_tx_time;
-                }
-                last_tx_time = tx_time_now;
-
-                // Attempt to send controller data (this will update next_delay for NEXT iteration)
-                esb_comm_status_t tx_status = send_controller_data();
-
-                // Debug: Track transmission attempts every 5 seconds during potential issues
-                static uint32_t tx_attempt_counter = 0;
-                static uint32_t last_tx_debug = 0;
-                tx_attempt_counter++;
-
-                uint32_t current_uptime = k_uptime_get_32();
-                if ((current_uptime - last_tx_debug) > 5000) // Every 5 seconds
-                {
-                        // Check if we're getting stuck in specific error states
-                        static uint32_t consecutive_errors = 0;
-                        if (tx_status != ESB_COMM_STATUS_OK)
-                        {
-                                consecutive_errors++;
-                        }
-                        else
-                        {
-                                consecutive_errors = 0;
-                        }
-
-                        // Get ESB statistics to see if radio is actually working
-                        esb_comm_stats_t esb_stats = {0};
-                        esb_comm_status_t stats_status = esb_comm_get_stats(&esb_stats);
-
-                        if (stats_status == ESB_COMM_STATUS_OK)
-                        {
-                                // ESB Watchdog: Detect when stats stop incrementing despite "successful" sends
-                                static uint32_t last_total_transmissions = 0;
-                                static uint32_t watchdog_counter = 0;
-
-                                if (esb_stats.total_transmissions == last_total_transmissions)
-                                {
-                                        watchdog_counter++;
-                                        LOG_WRN("ESB Watchdog: Stats frozen for %u periods (total: %u)",
-                                                watchdog_counter, esb_stats.total_transmissions);
-
-                                        // Reset ESB if stats haven't changed for 3 periods (15 seconds)
-                                        if (watchdog_counter >= 3)
-                                        {
-                                                LOG_ERR("ESB FROZEN - Attempting reset...");
-
-                                                // Reinitialize ESB communication
-                                                esb_comm_config_t esb_config = {
-                                                    .controller_id = CONTROLLER_ID,
-                                                    .base_tx_interval_ms = 5, // 5ms base interval (200Hz)
-                                                    .retry_interval_ms = 10,  // 10ms retry interval
-                                                    .rf_channel = 1,          // RF channel 1
-                                                    .status_led = &led0       // Use LED0 for status indication
-                                                };
-
-                                                esb_comm_status_t reset_status = esb_comm_driver_init(&esb_config);
-                                                if (reset_status == ESB_COMM_STATUS_OK)
-                                                {
-                                                        // Re-enable ACK timing after reset
-                                                        esb_comm_enable_ack_timing(true);
-                                                        LOG_INF("ESB reset successful");
-                                                }
-                                                else
-                                                {
-                                                        LOG_ERR("ESB reset failed: %d", reset_status);
-                                                }
-
-                                                watchdog_counter = 0;
-                                                last_total_transmissions = 0; // Reset tracking
-                                        }
-                                }
-                                else
-                                {
-                                        // Stats are incrementing normally
-                                        watchdog_counter = 0;
-                                        last_total_transmissions = esb_stats.total_transmissions;
-                                }
-
-                                LOG_INF("TX Debug: %u attempts, status: %d, trigger: %d, sticks: %d,%d, errors: %u",
-                                        tx_attempt_counter, tx_status, controller_data.trigger,
-                                        controller_data.stickX, controller_data.stickY, consecutive_errors);
-                                LOG_INF("ESB Stats: total: %u, success: %u, failed: %u, rate: %.1f%%, last_ok: %s",
-                                        esb_stats.total_transmissions, esb_stats.successful_transmissions,
-                                        esb_stats.failed_transmissions, esb_stats.success_rate * 100.0f,
-                                        esb_stats.last_tx_succeeded ? "yes" : "no");
-
-                                // Check for data corruption - log full controller data structure
-                                LOG_INF("Data Check: flags=0x%02X, buttons=0x%02X, padX=%d, padY=%d",
-                                        controller_data.flags, controller_data.buttons,
-                                        controller_data.padX, controller_data.padY);
-                                LOG_INF("Data Check: accelX=%d, accelY=%d, accelZ=%d",
-                                        controller_data.accelX, controller_data.accelY, controller_data.accelZ);
-
-                                // Corruption detection: Check for impossible values
-                                bool corruption_detected = false;
-                                if (controller_data.stickX < -127 || controller_data.stickX > 127)
-                                        corruption_detected = true;
-                                if (controller_data.stickY < -127 || controller_data.stickY > 127)
-                                        corruption_detected = true;
-                                if (controller_data.trigger > 255)
-                                        corruption_detected = true;
-                                if (abs(controller_data.padX) > 32767 || abs(controller_data.padY) > 32767)
-                                        corruption_detected = true;
-
-                                if (corruption_detected)
-                                {
-                                        LOG_ERR("DATA CORRUPTION DETECTED! Stick/trigger values out of range");
-                                }
-                        }
-                        else
-                        {
-                                LOG_ERR("Failed to get ESB stats: %d", stats_status);
-                        }
-                        last_tx_debug = current_uptime;
-                        tx_attempt_counter = 0;
-                }
-
-                uint32_t tx_end_cycles = k_cycle_get_32();
-                uint32_t tx_us = k_cyc_to_us_floor32(tx_end_cycles - tx_start_cycles);
-
-                // Track longest transmission time
-                static uint32_t max_tx_us = 0;
-                if (tx_us > max_tx_us)
-                {
-                        max_tx_us = tx_us;
-                }
-
-                // Log if transmission takes too long (>5ms is suspicious)
-                if (tx_us > 5000)
-                {
-                        LOG_WRN("SLOW ESB TRANSMISSION: %dus (max: %dus)", tx_us, max_tx_us);
-                }
-
-                // Debug logging every 1000 loops
-                // if (loop_counter % 1000 == 1)
-                // {
-                //         LOG_INF("Main loop running - iteration %u", loop_counter);
-                // }
-                // haptic_test_strong_effects();
-
-                // Timing diagnostics for latency spike detection
-                uint32_t loop_start_cycles = k_cycle_get_32();
-                static uint32_t last_loop_end_cycles = 0;
-                static uint32_t max_gap_us = 0;
-                static uint32_t max_loop_us = 0;
-
-                // Calculate gap since last loop (should be close to sleep_delay)
-                if (last_loop_end_cycles != 0)
-                {
-                        uint32_t gap_cycles = loop_start_cycles - last_loop_end_cycles;
-                        uint32_t gap_us = k_cyc_to_us_floor32(gap_cycles);
-                        if (gap_us > max_gap_us)
-                        {
-                                max_gap_us = gap_us;
-                        }
-
-                        // Log if gap is much larger than expected (>50ms = massive spike)
-                        if (gap_us > 50000)
-                        {
-                                LOG_WRN("LATENCY SPIKE: %dus gap between loops!", gap_us);
-                        }
-                }
-
-                // Update controller data immediately after transmission (don't wait)
-                uint32_t update_start_cycles = k_cycle_get_32();
-                update_controller_data();
-                uint32_t update_end_cycles = k_cycle_get_32();
-                uint32_t update_us = k_cyc_to_us_floor32(update_end_cycles - update_start_cycles);
-
-                // Track longest controller update time
-                static uint32_t max_update_us = 0;
-                if (update_us > max_update_us)
-                {
-                        max_update_us = update_us;
-                }
-
-                // Log if controller update takes too long (>10ms is suspicious)
-                if (update_us > 10000)
-                {
-                        LOG_WRN("SLOW CONTROLLER UPDATE: %dus (max: %dus)", update_us, max_update_us);
-                }
-
-                // Get delay for NEXT transmission from ACK payload (was updated during send_controller_data)
-                uint16_t next_delay = esb_comm_get_next_delay();
-
-                // Calculate what sleep delay to use for NEXT iteration
-                if (next_delay > 0 && next_delay <= 100)
-                {
-                        // Use dongle-requested timing (limited to reasonable range)
-                        current_sleep_delay = next_delay;
-                        // LOG_DBG("Dongle requested %dms for next TX (actual interval was: %ums, used delay: %ums)", 
-                        //         next_delay, actual_interval, sleep_delay);
-                }
-                else
-                {
-                        // Fallback to default timing if no ACK payload or invalid timing
-                        current_sleep_delay = 8;
-                        LOG_WRN("Invalid dongle delay (%d), using fallback: %dms for next TX (actual interval was: %ums, used delay: %ums)", 
-                                next_delay, current_sleep_delay, actual_interval, sleep_delay);
-                }
-
-                // Add radio busy backoff - if transmission failed due to busy radio,
-                // increase sleep delay to reduce pressure on the radio
-                static uint32_t consecutive_busy_count = 0;
-                if (tx_status == ESB_COMM_STATUS_BUSY)
-                {
-                        consecutive_busy_count++;
-                        // Exponential backoff: 2ms extra delay per consecutive failure
-                        uint16_t backoff_delay = consecutive_busy_count * 2;
-                        if (backoff_delay > 10)
-                                backoff_delay = 10; // Cap at 10ms extra
-                        sleep_delay += backoff_delay;
-
-                        if (consecutive_busy_count <= 3)
-                        { // Don't spam logs
-                                LOG_WRN("RADIO BUSY - adding %dms backoff (consecutive: %d)",
-                                        backoff_delay, consecutive_busy_count);
-                        }
-                }
-                else
-                {
-                        // Reset consecutive count on successful transmission
-                        consecutive_busy_count = 0;
-                }
-
-                // Subtract the ACTUAL time already spent (from start of iteration to now)
-                uint32_t iteration_end = k_uptime_get_32();
-                uint32_t elapsed_ms = iteration_end - iteration_start;
-                
-                if (elapsed_ms < sleep_delay)
-                {
-                        sleep_delay -= elapsed_ms;
-                }
-                else
-                {
-                        sleep_delay = 0; // No sleep needed, already over time
-                }
-
-                // Wait the calculated delay before next transmission (minimum 1ms to yield)
-                if (sleep_delay > 0)
-                {
-                        k_sleep(K_MSEC(sleep_delay));
-                }
-                else
-                {
-                        k_yield(); // Just yield to scheduler if no sleep needed
-                }
-
-                // Complete loop timing measurement
-                uint32_t loop_end_cycles = k_cycle_get_32();
-                uint32_t total_loop_us = k_cyc_to_us_floor32(loop_end_cycles - loop_start_cycles);
-                last_loop_end_cycles = loop_end_cycles;
-
-                // Track longest loop time
-                if (total_loop_us > max_loop_us)
-                {
-                        max_loop_us = total_loop_us;
-                }
-
-                // Log if total loop takes much longer than expected
-                uint32_t expected_loop_us = sleep_delay * 1000; // Convert ms to us
-                if (total_loop_us > (expected_loop_us + 10000))
-                { // >10ms over expected
-                        LOG_WRN("LONG LOOP: %dus (expected ~%dus, max: %dus)",
-                                total_loop_us, expected_loop_us, max_loop_us);
-                }
-
-                // Periodic summary every 10 seconds
-                static uint32_t last_summary = 0;
-                uint32_t summary_now = k_uptime_get_32();
-                if ((summary_now - last_summary) > 10000)
-                {
-                        LOG_INF("TIMING SUMMARY - TX:%dus, Update:%dus, Loop:%dus, Gap:%dus",
-                                max_tx_us, max_update_us, max_loop_us, max_gap_us);
-                        last_summary = summary_now;
-                        // Reset maximums for next period
-                        max_tx_us = 0;
-                        max_update_us = 0;
-                        max_loop_us = 0;
-                        max_gap_us = 0;
-                }
-
-                // Freeze detection: track how long this loop iteration took (legacy)
-                static uint32_t last_loop_time = 0;
-                static uint32_t max_loop_time = 0;
-                uint32_t loop_end_time = k_uptime_get_32();
-
-                if (last_loop_time != 0)
-                {
-                        uint32_t loop_duration = loop_end_time - last_loop_time;
-                        if (loop_duration > max_loop_time)
-                        {
-                                max_loop_time = loop_duration;
-                        }
-
-                        // Log if loop took unusually long (indicates freeze/blocking)
-                        if (loop_duration > 100)
-                        { // More than 100ms for one loop iteration
-                                LOG_WRN("Long loop iteration: %ums (max so far: %ums)", loop_duration, max_loop_time);
-                        }
-
-                        // Reset max every minute for trending
-                        static uint32_t last_max_reset = 0;
-                        if ((loop_end_time - last_max_reset) > 60000)
-                        {
-                                LOG_INF("Loop timing: max iteration time in last minute: %ums", max_loop_time);
-                                max_loop_time = 0;
-                                last_max_reset = loop_end_time;
-                        }
-                }
-
-                last_loop_time = loop_end_time;
-        }
+        LOG_INF("Radio stage and UI work queue started");
 
         return 0;
 }
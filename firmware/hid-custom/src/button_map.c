@@ -0,0 +1,91 @@
+#include "button_map.h"
+#include <string.h>
+
+// DS4 buttons1: 0 Square/X, 1 Cross/A, 2 Circle/B, 3 Triangle/Y, 4 L1, 5 R1
+// DS4 buttons2: 0 Share, 1 Options, 2 L3, 3 R3, 4 PS, 5 Touchpad click
+// Flags bit 7 is the controller ID and never maps to a button.
+
+// Left half: D-pad, bumper, stick click, select, trackpad click, mode
+static const uint32_t default_left_layout[BUTTON_MAP_INPUTS] = {
+    [0] = BUTTON_MAP_DPAD_UP,
+    [1] = BUTTON_MAP_DPAD_LEFT,
+    [2] = BUTTON_MAP_DPAD_RIGHT,
+    [3] = BUTTON_MAP_DPAD_DOWN,
+    [4] = BUTTON_MAP_B1(4),                     // Bumper -> L1
+    [5] = BUTTON_MAP_B2(2),                     // Stick click -> L3
+    [6] = BUTTON_MAP_B2(5),                     // Trackpad click
+    [7] = BUTTON_MAP_B2(0),                     // Select -> Share
+    [8 + 0] = BUTTON_MAP_B1(4),                 // P5 -> L1
+    [8 + 1] = BUTTON_MAP_B2(2),                 // P4 -> L3
+    [8 + 6] = BUTTON_MAP_B2(4),                 // Mode -> PS
+};
+
+// Right half: face buttons, bumper, stick click, start, trackpad click, guide
+static const uint32_t default_right_layout[BUTTON_MAP_INPUTS] = {
+    [0] = BUTTON_MAP_B1(3),                     // Y -> Triangle
+    [1] = BUTTON_MAP_B1(0),                     // X -> Square
+    [2] = BUTTON_MAP_B1(2),                     // B -> Circle
+    [3] = BUTTON_MAP_B1(1),                     // A -> Cross
+    [4] = BUTTON_MAP_B1(5),                     // Bumper -> R1
+    [5] = BUTTON_MAP_B2(3),                     // Stick click -> R3
+    [6] = BUTTON_MAP_B2(5),                     // Trackpad click
+    [7] = BUTTON_MAP_B2(1),                     // Start -> Options
+    [8 + 0] = BUTTON_MAP_B1(1),                 // P5 -> Cross
+    [8 + 1] = BUTTON_MAP_B2(3),                 // P4 -> R3
+    [8 + 6] = BUTTON_MAP_B2(4) | BUTTON_MAP_B1(1), // Guide -> PS + Cross
+};
+
+// Per half, one table for the buttons byte and one for the flags byte
+static uint32_t lut_buttons[2][256];
+static uint32_t lut_flags[2][256];
+
+// D-pad direction bits (up, right, down, left) -> hat value; opposing directions read as neutral
+static const uint8_t hat_lut[16] = {
+    8, 0, 2, 1, 4, 8, 3, 8,
+    6, 7, 8, 8, 5, 8, 8, 8,
+};
+
+static void build_tables(int half, const uint32_t layout[BUTTON_MAP_INPUTS])
+{
+    for (int value = 0; value < 256; value++)
+    {
+        uint32_t buttons_out = 0;
+        uint32_t flags_out = 0;
+
+        for (int bit = 0; bit < 8; bit++)
+        {
+            if (value & (1 << bit))
+            {
+                buttons_out |= layout[bit];
+                if (bit != 7) // Controller ID
+                {
+                    flags_out |= layout[8 + bit];
+                }
+            }
+        }
+
+        lut_buttons[half][value] = buttons_out;
+        lut_flags[half][value] = flags_out;
+    }
+}
+
+void button_map_init(void)
+{
+    build_tables(1, default_left_layout);
+    build_tables(0, default_right_layout);
+}
+
+void button_map_set_layout(bool left, const uint32_t layout[BUTTON_MAP_INPUTS])
+{
+    build_tables(left ? 1 : 0, layout);
+}
+
+void button_map_decode(uint16_t left_inputs, uint16_t right_inputs, ds4_buttons_t *out)
+{
+    uint32_t word = lut_buttons[1][left_inputs & 0xFF] | lut_flags[1][left_inputs >> 8] |
+                    lut_buttons[0][right_inputs & 0xFF] | lut_flags[0][right_inputs >> 8];
+
+    out->dpad = hat_lut[(word >> 16) & 0x0F];
+    out->buttons1 = (uint8_t)word;
+    out->buttons2 = (uint8_t)(word >> 8);
+}
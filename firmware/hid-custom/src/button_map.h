@@ -0,0 +1,41 @@
+#ifndef BUTTON_MAP_H
+#define BUTTON_MAP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Physical inputs per controller half: bits 0-7 = controller_data_t.buttons, bits 8-15 = flags
+#define BUTTON_MAP_INPUTS 16
+
+// Output word produced by the lookup tables
+#define BUTTON_MAP_B1(bit)   (1UL << (bit))         // DS4 buttons1 bit
+#define BUTTON_MAP_B2(bit)   (1UL << (8 + (bit)))   // DS4 buttons2 bit
+#define BUTTON_MAP_DPAD_UP    (1UL << 16)
+#define BUTTON_MAP_DPAD_RIGHT (1UL << 17)
+#define BUTTON_MAP_DPAD_DOWN  (1UL << 18)
+#define BUTTON_MAP_DPAD_LEFT  (1UL << 19)
+
+// Decoded DS4 button state
+typedef struct
+{
+    uint8_t dpad;     // Hat switch 0-7, 8 = neutral
+    uint8_t buttons1;
+    uint8_t buttons2;
+} ds4_buttons_t;
+
+// Build the lookup tables from the default layout for both halves
+void button_map_init(void);
+
+// Replace one half's layout (output word per physical input, 0 = unbound) and rebuild its tables
+void button_map_set_layout(bool left, const uint32_t layout[BUTTON_MAP_INPUTS]);
+
+// Decode both halves' physical buttons into DS4 buttons
+void button_map_decode(uint16_t left_inputs, uint16_t right_inputs, ds4_buttons_t *out);
+
+// Pack a half's buttons and flags into the physical input word
+static inline uint16_t button_map_inputs(uint8_t buttons, uint8_t flags)
+{
+    return (uint16_t)buttons | ((uint16_t)flags << 8);
+}
+
+#endif // BUTTON_MAP_H
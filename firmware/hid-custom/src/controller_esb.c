@@ -3,6 +3,8 @@
 #include <zephyr/drivers/clock_control.h>
 #include <zephyr/drivers/clock_control/nrf_clock_control.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <nrfx_timer.h>
 
 LOG_MODULE_REGISTER(controller_esb, LOG_LEVEL_INF);
 
@@ -10,8 +12,20 @@ LOG_MODULE_REGISTER(controller_esb, LOG_LEVEL_INF);
 static struct esb_payload rx_payload;
 
 // SEPARATE CONTROLLER STATES - prevents data corruption between controllers
-static simple_controller_state_t left_controller_state = {0};   // Index 1 (flags & 0x80 = true)
-static simple_controller_state_t right_controller_state = {0};  // Index 0 (flags & 0x80 = false)
+// Each half publishes complete snapshots into its own lock-free SPSC ring: the ESB ISR is the
+// only writer, the report thread the only reader. [0] = RIGHT (pipe 0), [1] = LEFT (pipe 1)
+typedef struct
+{
+    simple_controller_state_t slots[CONTROLLER_STATE_RING_SIZE];
+    atomic_t head;              // Snapshots published so far (written by ISR only)
+    uint32_t consumed_head;     // Head at the consumer's last read
+    uint32_t overwritten;       // Snapshots superseded before the consumer saw them
+} controller_state_ring_t;
+
+static controller_state_ring_t state_ring[ESB_TDMA_NUM_SLOTS];
+
+// Signalled on every published snapshot - limit 1 so a burst of packets wakes the report thread once
+static K_SEM_DEFINE(rx_data_sem, 0, 1);
 
 // LED for debug feedback
 static const struct gpio_dt_spec led0 = GPIO_DT_SPEC_GET(DT_ALIAS(led0), gpios);
@@ -19,11 +33,329 @@ static const struct gpio_dt_spec led0 = GPIO_DT_SPEC_GET(DT_ALIAS(led0), gpios);
 // Timing tracking for packet logging
 static uint32_t last_packet_time = 0;
 
+// Wire decoder state per pipe - delta packets only carry changed fields
+static controller_data_t wire_state[ESB_TDMA_NUM_SLOTS];
+static bool wire_synced[ESB_TDMA_NUM_SLOTS];    // Keyframe received since boot
+static uint32_t wire_rejected = 0;              // Malformed / wrong version packets
+
+// Bytes each change-mask bit adds to a packet (mask bit order)
+static const uint8_t wire_field_size[] = {1, 1, 2, 4, 1, 6, 6};
+
+// Received IMU samples per pipe - ESB ISR produces, main loop consumes
+static controller_imu_sample_t imu_ring[ESB_TDMA_NUM_SLOTS][CONTROLLER_IMU_RING_SIZE];
+static atomic_t imu_ring_head[ESB_TDMA_NUM_SLOTS];   // Written by ISR
+static atomic_t imu_ring_tail[ESB_TDMA_NUM_SLOTS];   // Written by main loop
+static uint8_t imu_next_seq[ESB_TDMA_NUM_SLOTS];     // Next sample sequence expected per pipe
+static bool imu_seq_valid[ESB_TDMA_NUM_SLOTS];
+static bool imu_restart_seen[ESB_TDMA_NUM_SLOTS];   // Restart already applied - later flagged packets are resends
+static uint32_t imu_ring_overflows = 0;
+
 // ACK payload timing control variables
 static uint8_t sequence_counter = 0;
-static uint32_t last_tx_time[2] = {0, 0};  // Separate timing for each controller: [0]=right, [1]=left
-static uint32_t last_any_rx_time = 0;      // Track most recent packet from ANY controller for collision detection
-static const uint16_t BASE_INTERVAL_MS = 4;  // 4ms intervals for stable performance
+static uint32_t last_rx_time_us[2] = {0, 0};  // Separate timing for each controller: [0]=right, [1]=left
+static uint32_t last_any_rx_time_us = 0;      // Track most recent packet from ANY controller for collision detection
+static uint8_t last_rx_controller_id = 0;
+
+// Host rumble per pipe - set from the USB thread, read by the ESB ISR when building ACK payloads
+static uint8_t rumble_amplitude[ESB_TDMA_NUM_SLOTS];
+static uint32_t rumble_set_time_us[ESB_TDMA_NUM_SLOTS];   // When the current amplitude was set
+
+// Microsecond timebase for TDMA slot phase and ACK timestamps (free-running TIMER1 @ 1MHz)
+static const nrfx_timer_t esb_timebase = NRFX_TIMER_INSTANCE(1);
+
+static void esb_timebase_handler(nrf_timer_event_t event_type, void *p_context)
+{
+    // Free-running counter only - no compare events are enabled
+    ARG_UNUSED(event_type);
+    ARG_UNUSED(p_context);
+}
+
+static int esb_timebase_init(void)
+{
+    nrfx_timer_config_t timer_cfg = NRFX_TIMER_DEFAULT_CONFIG(1000000);
+    timer_cfg.bit_width = NRF_TIMER_BIT_WIDTH_32;
+
+    IRQ_CONNECT(TIMER1_IRQn, DT_IRQ(DT_NODELABEL(timer1), priority), nrfx_isr, nrfx_timer_1_irq_handler, 0);
+
+    nrfx_err_t err = nrfx_timer_init(&esb_timebase, &timer_cfg, esb_timebase_handler);
+    if (err != NRFX_SUCCESS)
+    {
+        LOG_ERR("Timebase timer init failed: 0x%08x", err);
+        return -EIO;
+    }
+
+    nrfx_timer_enable(&esb_timebase);
+    return 0;
+}
+
+// Publish a complete snapshot (ISR side) - slot is filled before head moves, so readers never see it half written
+static void state_ring_publish(uint8_t pipe, const simple_controller_state_t *state)
+{
+    controller_state_ring_t *ring = &state_ring[pipe];
+    uint32_t head = atomic_get(&ring->head);
+    simple_controller_state_t *slot = &ring->slots[head % CONTROLLER_STATE_RING_SIZE];
+
+    *slot = *state;
+    slot->sequence = head + 1;
+    atomic_set(&ring->head, head + 1);
+}
+
+// Copy the freshest snapshot (reader side), returns the head it was taken at (0 = nothing published yet)
+static uint32_t state_ring_read_latest(const controller_state_ring_t *ring, simple_controller_state_t *snapshot)
+{
+    uint32_t head;
+
+    do
+    {
+        head = atomic_get(&ring->head);
+        if (head == 0)
+        {
+            memset(snapshot, 0, sizeof(*snapshot));
+            return 0;
+        }
+        *snapshot = ring->slots[(head - 1) % CONTROLLER_STATE_RING_SIZE];
+        // If the producer wrapped around onto our slot while we copied, take the new freshest one
+    } while (atomic_get(&ring->head) - head >= CONTROLLER_STATE_RING_SIZE - 1);
+
+    return head;
+}
+
+// Queue one IMU sample for the main loop (drops the sample if the consumer is behind)
+static void imu_ring_push(uint8_t pipe, const controller_imu_sample_t *sample)
+{
+    uint32_t head = atomic_get(&imu_ring_head[pipe]);
+    uint32_t tail = atomic_get(&imu_ring_tail[pipe]);
+
+    if (head - tail >= CONTROLLER_IMU_RING_SIZE)
+    {
+        imu_ring_overflows++;
+        return;
+    }
+
+    imu_ring[pipe][head % CONTROLLER_IMU_RING_SIZE] = *sample;
+    atomic_set(&imu_ring_head[pipe], head + 1);
+}
+
+// Bytes an IMU batch occupies according to its header, -1 if the header is invalid
+static int wire_imu_batch_size(const uint8_t *p, int available)
+{
+    if (available < ESB_WIRE_IMU_HEADER_SIZE || p[1] == 0 || p[1] > ESB_WIRE_IMU_BATCH_MAX)
+    {
+        return -1;
+    }
+
+    int size = ESB_WIRE_IMU_HEADER_SIZE;
+    for (uint8_t i = 0; i < p[1]; i++)
+    {
+        size += ((i == 0) || (p[2] & BIT(i))) ? 12 : 6;
+    }
+    return size;
+}
+
+// Parse a validated IMU batch - samples already seen (resent after a lost ACK) are skipped by sequence number
+// The newest sample is stamped with the packet's arrival time, older ones one sample period apart
+static void wire_decode_imu_batch(uint8_t pipe, const uint8_t *p, bool restart, uint32_t rx_time_us,
+                                  controller_data_t *state)
+{
+    uint8_t seq = p[0];
+    uint8_t count = p[1];
+    uint8_t full_flags = p[2];
+    p += ESB_WIRE_IMU_HEADER_SIZE;
+
+    // A rebooted controller numbers from 0 again - forget the old sequence once per restart,
+    // the flag stays set on resends until the controller sees an ACK
+    if (restart && !imu_restart_seen[pipe])
+    {
+        imu_seq_valid[pipe] = false;
+    }
+    imu_restart_seen[pipe] = restart;
+
+    int16_t v[6] = {0};
+    for (uint8_t i = 0; i < count; i++, seq++)
+    {
+        bool full = (i == 0) || (full_flags & BIT(i));
+        for (int axis = 0; axis < 6; axis++)
+        {
+            if (full)
+            {
+                v[axis] = (int16_t)sys_get_le16(p);
+                p += 2;
+            }
+            else
+            {
+                v[axis] += (int8_t)*p++;
+            }
+        }
+
+        // Resends are at most one controller queue behind - anything further back means the controller restarted
+        int8_t seq_diff = (int8_t)(seq - imu_next_seq[pipe]);
+        if (!imu_seq_valid[pipe] || seq_diff >= 0 || seq_diff < -CONTROLLER_IMU_RING_SIZE)
+        {
+            // Only the IMU half is queued - nothing drains the other ring
+            if (pipe == CONTROLLER_IMU_PIPE)
+            {
+                controller_imu_sample_t sample = {v[0], v[1], v[2], v[3], v[4], v[5],
+                                                  rx_time_us - (count - 1 - i) * CONTROLLER_IMU_PERIOD_US};
+                imu_ring_push(pipe, &sample);
+            }
+            imu_next_seq[pipe] = seq + 1;
+            imu_seq_valid[pipe] = true;
+        }
+    }
+
+    // Newest sample is the current accel/gyro state
+    state->accelX = v[0];
+    state->accelY = v[1];
+    state->accelZ = v[2];
+    state->gyroX = v[3];
+    state->gyroY = v[4];
+    state->gyroZ = v[5];
+}
+
+// Payload length implied by a change mask (fixed fields only)
+static uint8_t wire_payload_size(uint8_t mask)
+{
+    uint8_t size = ESB_WIRE_HEADER_SIZE;
+    for (int i = 0; i < ARRAY_SIZE(wire_field_size); i++)
+    {
+        if (mask & BIT(i))
+        {
+            size += wire_field_size[i];
+        }
+    }
+    return size;
+}
+
+// Apply a wire packet onto the pipe's reconstructed state - false if malformed
+static bool wire_decode_packet(uint8_t pipe, const uint8_t *buf, uint8_t length, uint32_t rx_time_us,
+                               controller_data_t *state, bool *keyframe)
+{
+    if (length < ESB_WIRE_HEADER_SIZE || (buf[0] >> 4) != ESB_WIRE_VERSION)
+    {
+        return false;
+    }
+
+    uint8_t mask = buf[1];
+    uint8_t fixed_size = wire_payload_size(mask & ESB_WIRE_FIELD_ALL);
+    bool has_batch = (mask & ESB_WIRE_FIELD_IMU_BATCH) != 0;
+    bool has_touch = (buf[0] & ESB_WIRE_EXT_TOUCH) != 0;
+    *keyframe = (buf[0] & ESB_WIRE_KEYFRAME) != 0;
+    if ((*keyframe && ((mask & ESB_WIRE_FIELD_ALL) != ESB_WIRE_FIELD_ALL || !has_touch)) ||
+        (has_touch && length <= fixed_size))
+    {
+        return false;
+    }
+
+    // Touch block size comes from its first byte, the IMU batch takes the rest
+    uint8_t batch_offset = fixed_size + (has_touch ? ESB_WIRE_TOUCH_SIZE(buf[fixed_size]) : 0);
+    if (has_batch ? length < batch_offset : length != batch_offset)
+    {
+        return false;
+    }
+
+    // Validate the batch length before touching state so a malformed packet leaves it unchanged
+    if (has_batch && wire_imu_batch_size(buf + batch_offset, length - batch_offset) != length - batch_offset)
+    {
+        return false;
+    }
+
+    const uint8_t *p = buf + ESB_WIRE_HEADER_SIZE;
+    if (mask & ESB_WIRE_FIELD_FLAGS)
+    {
+        state->flags = *p++;
+    }
+    if (mask & ESB_WIRE_FIELD_TRIGGER)
+    {
+        state->trigger = *p++;
+    }
+    if (mask & ESB_WIRE_FIELD_STICK)
+    {
+        state->stickX = (int8_t)*p++;
+        state->stickY = (int8_t)*p++;
+    }
+    if (mask & ESB_WIRE_FIELD_PAD)
+    {
+        state->padX = (int16_t)sys_get_le16(p);
+        state->padY = (int16_t)sys_get_le16(p + 2);
+        p += 4;
+    }
+    if (mask & ESB_WIRE_FIELD_BUTTONS)
+    {
+        state->buttons = *p++;
+    }
+    if (mask & ESB_WIRE_FIELD_ACCEL)
+    {
+        state->accelX = (int16_t)sys_get_le16(p);
+        state->accelY = (int16_t)sys_get_le16(p + 2);
+        state->accelZ = (int16_t)sys_get_le16(p + 4);
+        p += 6;
+    }
+    if (mask & ESB_WIRE_FIELD_GYRO)
+    {
+        state->gyroX = (int16_t)sys_get_le16(p);
+        state->gyroY = (int16_t)sys_get_le16(p + 2);
+        state->gyroZ = (int16_t)sys_get_le16(p + 4);
+        p += 6;
+    }
+    if (has_touch)
+    {
+        state->touch = *p++;
+        p++; // padStrength
+        if (ESB_WIRE_TOUCH_SIZE(state->touch) > 2)
+        {
+            state->pad2X = p[0] | ((p[1] & 0x0F) << 8);
+            state->pad2Y = (p[1] >> 4) | (p[2] << 4);
+            p += 4; // Coordinates + pad2Strength
+        }
+        else
+        {
+            state->pad2X = 0;
+            state->pad2Y = 0;
+        }
+    }
+    if (has_batch)
+    {
+        wire_decode_imu_batch(pipe, p, (buf[0] & ESB_WIRE_IMU_RESTART) != 0, rx_time_us, state);
+    }
+
+    return true;
+}
+
+// Phase of a packet arrival relative to the target point inside its pipe's slot, wrapped to +/- half a superframe
+static int16_t tdma_slot_phase_us(uint8_t pipe, uint32_t rx_time_us)
+{
+    if (pipe >= ESB_TDMA_NUM_SLOTS)
+    {
+        return 0;
+    }
+
+    int32_t target = (int32_t)(pipe * ESB_TDMA_SLOT_US + ESB_TDMA_ARRIVAL_OFFSET_US);
+    int32_t phase = (int32_t)(rx_time_us % ESB_TDMA_SUPERFRAME_US) - target;
+
+    if (phase >= ESB_TDMA_SUPERFRAME_US / 2)
+    {
+        phase -= ESB_TDMA_SUPERFRAME_US;
+    }
+    else if (phase < -(ESB_TDMA_SUPERFRAME_US / 2))
+    {
+        phase += ESB_TDMA_SUPERFRAME_US;
+    }
+
+    return (int16_t)phase;
+}
+
+// Time since the pipe's rumble amplitude was set, as carried in the ACK payload (called from the ESB ISR)
+static uint16_t rumble_age_us(uint8_t pipe, uint32_t rx_time_us)
+{
+    int32_t age = (int32_t)(rx_time_us - rumble_set_time_us[pipe]);
+
+    // Set while this packet was being processed - the ACK still carries it
+    if (age < 0)
+    {
+        return 0;
+    }
+    return (uint16_t)MIN(age, UINT16_MAX);
+}
 
 // ESB event handler for ACK-based reception
 static void simple_esb_event_handler(struct esb_evt const *event)
@@ -42,57 +374,69 @@ static void simple_esb_event_handler(struct esb_evt const *event)
         // Get the received data
         if (esb_read_rx_payload(&rx_payload) == 0)
         {
-            // Filter out spurious packets - we only want controller data
-            if (rx_payload.length == sizeof(controller_data_t))
+            // Filter out spurious packets - decode variable-length wire packet onto the pipe's state
+            uint32_t rx_time_us = controller_esb_time_us();
+            bool keyframe = false;
+            if (rx_payload.pipe < ESB_TDMA_NUM_SLOTS &&
+                wire_decode_packet(rx_payload.pipe, rx_payload.data, rx_payload.length, rx_time_us,
+                                   &wire_state[rx_payload.pipe], &keyframe))
             {
                 // LOG_INF("Valid controller data - length: %d, pipe: %d", rx_payload.length, rx_payload.pipe);
-                // Parse the controller data
-                controller_data_t *data = (controller_data_t *)rx_payload.data;
+                // Pipe identifies the half (flags may be omitted from delta packets): pipe 1 = LEFT, pipe 0 = RIGHT
+                const controller_data_t *data = &wire_state[rx_payload.pipe];
+                wire_synced[rx_payload.pipe] |= keyframe;
 
                 // Calculate timing and determine controller half
                 uint32_t current_time = k_uptime_get_32();
                 uint32_t time_diff = current_time - last_packet_time;
-                bool is_left = (data->flags & 0x80) != 0;
+                bool is_left = rx_payload.pipe == 1;
                 uint8_t controller_id = is_left ? 1 : 0;
 
                 // Calculate gap since ANY controller packet for collision detection (BEFORE updating timing)
-                uint32_t gap_since_any = (last_any_rx_time == 0) ? 0 : (current_time - last_any_rx_time);
+                uint32_t gap_since_any_us = (last_any_rx_time_us == 0) ? 0 : (rx_time_us - last_any_rx_time_us);
 
-                // Log only problematic timing patterns to reduce logging overhead
-                if (last_packet_time != 0 && time_diff < 2)
+                // With TDMA the halves should be a full slot apart - only log packets that overlap windows
+                if (last_any_rx_time_us != 0 && last_rx_controller_id != controller_id &&
+                    gap_since_any_us < ESB_TDMA_MIN_GAP_US)
                 {
-                    LOG_WRN("COLLISION: %s controller - %dms gap (too close!)",
-                            is_left ? "LEFT" : "RIGHT", time_diff);
-                    
-                    // Also log per-controller timing for collisions
-                    uint32_t controller_gap = (last_tx_time[controller_id] == 0) ? 0 : 
-                                             (current_time - last_tx_time[controller_id]);
-                    LOG_WRN("    Controller gap: %dms since last from THIS controller", controller_gap);
+                    LOG_WRN("COLLISION: %s controller - %dus gap (too close!)",
+                            is_left ? "LEFT" : "RIGHT", gap_since_any_us);
                 }
 
                 // Update timing variables AFTER calculating gaps
                 last_packet_time = current_time;
-                last_any_rx_time = current_time;
+                last_any_rx_time_us = rx_time_us;
+                last_rx_controller_id = controller_id;
 
-                // IMMEDIATE CONTROLLER ROUTING - store data in correct controller array immediately
-                // This prevents data corruption when both controllers transmit rapidly
-                simple_controller_state_t *target_controller = is_left ? &left_controller_state : &right_controller_state;
-                
-                target_controller->flags = data->flags;
-                target_controller->trigger = data->trigger;
-                target_controller->stickX = data->stickX;
-                target_controller->stickY = data->stickY;
-                target_controller->padX = data->padX;
-                target_controller->padY = data->padY;
-                target_controller->buttons = data->buttons;
-                target_controller->accelX = data->accelX;
-                target_controller->accelY = data->accelY;
-                target_controller->accelZ = data->accelZ;
-                target_controller->gyroX = data->gyroX;
-                target_controller->gyroY = data->gyroY;
-                target_controller->gyroZ = data->gyroZ;
-                target_controller->data_received = true;
-                target_controller->last_ping_time = current_time;
+                // IMMEDIATE CONTROLLER ROUTING - publish a complete snapshot to the half's ring
+                // Built locally first so the report thread can never see a mix of two packets
+                // Until the first keyframe the reconstructed state is incomplete - keep timing/ACKs going but don't publish
+                if (wire_synced[rx_payload.pipe])
+                {
+                    simple_controller_state_t snapshot = {
+                        .flags = data->flags,
+                        .trigger = data->trigger,
+                        .stickX = data->stickX,
+                        .stickY = data->stickY,
+                        .padX = data->padX,
+                        .padY = data->padY,
+                        .buttons = data->buttons,
+                        .accelX = data->accelX,
+                        .accelY = data->accelY,
+                        .accelZ = data->accelZ,
+                        .gyroX = data->gyroX,
+                        .gyroY = data->gyroY,
+                        .gyroZ = data->gyroZ,
+                        .touch = data->touch,
+                        .pad2X = data->pad2X,
+                        .pad2Y = data->pad2Y,
+                        .data_received = true,
+                        .last_ping_time = current_time,
+                        .rx_time_us = rx_time_us,
+                    };
+                    state_ring_publish(rx_payload.pipe, &snapshot);
+                    k_sem_give(&rx_data_sem);
+                }
 
                 // Track severe delays that indicate controller-side issues
                 if (time_diff > 50) {
@@ -100,52 +444,33 @@ static void simple_esb_event_handler(struct esb_evt const *event)
                             time_diff, is_left ? "LEFT" : "RIGHT");
                 }
 
-                // Create ACK payload with timing control + rumble (lean 8-byte design)
+                // Create ACK payload with slot timing + rumble (lean 12-byte design)
+                // The controller nudges its slot timer by the measured phase so it lands in its own window
                 ack_timing_data_t ack_data = {
-                    .next_delay_ms = 0,        // Will calculate below
+                    .superframe_us = ESB_TDMA_SUPERFRAME_US,
+                    .slot_phase_us = tdma_slot_phase_us(rx_payload.pipe, rx_time_us),
                     .sequence_num = sequence_counter++,
-                    .rumble_data = 0x00,       // No rumble for now: left=0, right=0 
-                    .dongle_timestamp = current_time
+                    .rumble = rumble_amplitude[rx_payload.pipe],
+                    .dongle_timestamp = rx_time_us,
+                    .rumble_age_us = rumble_age_us(rx_payload.pipe, rx_time_us)
                 };
                 
-                // Staggered timing to prevent packet collisions
-                // Both controllers use the same base interval
-                uint32_t base_delay = BASE_INTERVAL_MS;  // 4ms for both
-                
-                // Dynamic collision avoidance - ensure minimum 2ms gap between transmissions
-                // Calculate how much padding is needed to achieve 2ms separation
-                uint32_t padding = 0;
-                const uint32_t MIN_GAP_MS = 2; // Minimum desired gap between controller packets
-                
-                if (gap_since_any > 0 && gap_since_any < MIN_GAP_MS) {
-                    // Too close! Add padding to push this controller's next transmission out
-                    // so it doesn't collide with the other controller's next transmission
-                    padding = MIN_GAP_MS - gap_since_any;
-                    LOG_WRN("COLLISION DETECTED: %s controller gap=%dms (target=%dms), adding %dms padding", 
-                            is_left ? "LEFT" : "RIGHT", gap_since_any, MIN_GAP_MS, padding);
-                }
-                
-                // Set the delay: base interval + dynamic padding to maintain 2ms separation
-                ack_data.next_delay_ms = base_delay + padding;
-                
-                // Log what timing we're actually sending to controllers - every 10th packet to reduce spam
+                // Log what timing we're actually sending to controllers - every 100th packet to reduce spam
                 static uint32_t log_counter = 0;
-                if (++log_counter % 10 == 0) {
-                    uint32_t time_since_last = (last_tx_time[controller_id] == 0) ? 0 : (current_time - last_tx_time[controller_id]);
-                    LOG_WRN("%s controller: base=%dms, since_last=%dms, sending_delay=%dms, padding=%dms",
-                            is_left ? "LEFT" : "RIGHT", base_delay, time_since_last, ack_data.next_delay_ms, padding);
+                if (++log_counter % 100 == 0) {
+                    uint32_t time_since_last = (last_rx_time_us[controller_id] == 0) ? 0 : (rx_time_us - last_rx_time_us[controller_id]);
+                    LOG_WRN("%s controller: superframe=%dus, since_last=%dus, slot_phase=%dus",
+                            is_left ? "LEFT" : "RIGHT", ack_data.superframe_us, time_since_last, ack_data.slot_phase_us);
                 }
                 
-                // Update last transmission time tracking (per-controller)
-                last_tx_time[controller_id] = current_time;
-                
-                // NOTE: last_any_rx_time already updated above after gap calculation
+                // Update last reception time tracking (per-controller)
+                last_rx_time_us[controller_id] = rx_time_us;
                 
                 // Queue ACK payload using Nordic's approach - this goes into TX FIFO
                 // and will be attached to the ACK for the NEXT packet received on this pipe
                 struct esb_payload ack_tx_payload = {0};
                 ack_tx_payload.pipe = rx_payload.pipe;        // CRUCIAL - same pipe as RX
-                ack_tx_payload.length = sizeof(ack_timing_data_t); // 8 bytes
+                ack_tx_payload.length = sizeof(ack_timing_data_t); // 12 bytes
                 memcpy(ack_tx_payload.data, &ack_data, ack_tx_payload.length);
                 
                 // Queue it - this attaches to the next ACK on this pipe
@@ -156,8 +481,8 @@ static void simple_esb_event_handler(struct esb_evt const *event)
                     // DEBUG: Let's verify we're actually sending ACK payloads
                     static uint32_t ack_counter = 0;
                     if (++ack_counter % 20 == 0) {
-                        LOG_INF("ACK payload sent: delay=%dms, pipe=%d, seq=%d", 
-                               ack_data.next_delay_ms, rx_payload.pipe, ack_data.sequence_num);
+                        LOG_INF("ACK payload sent: phase=%dus, pipe=%d, seq=%d", 
+                               ack_data.slot_phase_us, rx_payload.pipe, ack_data.sequence_num);
                     }
                 }
 
@@ -165,8 +490,9 @@ static void simple_esb_event_handler(struct esb_evt const *event)
             }
             else
             {
-                // LOG_DBG("Ignoring packet with wrong length: %d (expected %d)",
-                //         rx_payload.length, sizeof(controller_data_t));
+                wire_rejected++;
+                // LOG_DBG("Ignoring malformed packet: length %d, pipe %d (rejected: %u)",
+                //         rx_payload.length, rx_payload.pipe, wire_rejected);
             }
         }
         else
@@ -265,6 +591,13 @@ int controller_esb_init(void)
         return err;
     }
 
+    // Start the microsecond timebase used for slot scheduling
+    err = esb_timebase_init();
+    if (err)
+    {
+        return err;
+    }
+
     // Initialize LED
     if (!gpio_is_ready_dt(&led0))
     {
@@ -278,7 +611,7 @@ int controller_esb_init(void)
     config.protocol = ESB_PROTOCOL_ESB_DPL;
     config.mode = ESB_MODE_PRX; // Receiver mode to listen and send ACKs
     config.retransmit_delay = 1000;
-    config.retransmit_count = 5;
+    config.retransmit_count = 0; // PRX side - retransmits are driven by the controllers (disabled for TDMA)
     config.event_handler = simple_esb_event_handler;
     config.bitrate = ESB_BITRATE_2MBPS;
     config.selective_auto_ack = true; // Enable ACK for timing coordination
@@ -365,22 +698,41 @@ int controller_esb_init(void)
 }
 
 // Get current controller state
-// Legacy function - returns right controller for backward compatibility
-simple_controller_state_t *controller_esb_get_state(void)
+// Get a coherent copy of the freshest snapshot for one half
+bool controller_esb_get_snapshot(bool left, simple_controller_state_t *snapshot, uint32_t *overwritten)
 {
-    return &right_controller_state;
+    controller_state_ring_t *ring = &state_ring[left ? 1 : 0];
+    uint32_t head = state_ring_read_latest(ring, snapshot);
+
+    // Everything published between our last read and the one we just took was never seen
+    uint32_t skipped = (head > ring->consumed_head) ? head - ring->consumed_head - 1 : 0;
+    ring->overwritten += skipped;
+    ring->consumed_head = head;
+
+    if (overwritten)
+    {
+        *overwritten = skipped;
+    }
+
+    return head != 0;
 }
 
-// Get left controller state
-simple_controller_state_t *controller_esb_get_left_state(void)
+// Block until a new snapshot is published (or timeout)
+int controller_esb_wait_for_data(k_timeout_t timeout)
 {
-    return &left_controller_state;
+    return k_sem_take(&rx_data_sem, timeout);
 }
 
-// Get right controller state
-simple_controller_state_t *controller_esb_get_right_state(void)
+// Drop a pending wakeup - data that arrived so far will be in the report about to be built
+void controller_esb_clear_data_event(void)
 {
-    return &right_controller_state;
+    k_sem_reset(&rx_data_sem);
+}
+
+// Total snapshots superseded before the report thread consumed them
+uint32_t controller_esb_get_overwritten_count(bool left)
+{
+    return state_ring[left ? 1 : 0].overwritten;
 }
 
 // Check if we have new data from either controller
@@ -388,9 +740,55 @@ bool controller_esb_has_new_data(void)
 {
     // Consider data "new" if we received it within the last 100ms from either controller
     uint32_t now = k_uptime_get_32();
-    bool left_has_data = left_controller_state.data_received &&
-                        (now - left_controller_state.last_ping_time) < 100;
-    bool right_has_data = right_controller_state.data_received &&
-                         (now - right_controller_state.last_ping_time) < 100;
+    simple_controller_state_t left_state, right_state;
+    bool left_has_data = state_ring_read_latest(&state_ring[1], &left_state) != 0 &&
+                        (now - left_state.last_ping_time) < 100;
+    bool right_has_data = state_ring_read_latest(&state_ring[0], &right_state) != 0 &&
+                         (now - right_state.last_ping_time) < 100;
     return left_has_data || right_has_data;
 }
+
+
+// Get the dongle microsecond timebase
+uint32_t controller_esb_time_us(void)
+{
+    // Capture + read must not be split by the radio ISR using the same channel
+    unsigned int key = irq_lock();
+    uint32_t now = nrfx_timer_capture(&esb_timebase, NRF_TIMER_CC_CHANNEL0);
+    irq_unlock(key);
+
+    return now;
+}
+
+// Host motor amplitude for one half - only a change restarts the age the controller measures latency from
+void controller_esb_set_rumble(bool left, uint8_t amplitude)
+{
+    uint8_t pipe = left ? 1 : 0;
+    uint32_t now = controller_esb_time_us();
+
+    unsigned int key = irq_lock();
+    if (rumble_amplitude[pipe] != amplitude)
+    {
+        rumble_amplitude[pipe] = amplitude;
+        rumble_set_time_us[pipe] = now;
+    }
+    irq_unlock(key);
+}
+
+// Pop received IMU samples for one half in capture order
+int controller_esb_pop_imu_samples(bool left, controller_imu_sample_t *samples, int max_samples)
+{
+    uint8_t pipe = left ? 1 : 0;
+    uint32_t tail = atomic_get(&imu_ring_tail[pipe]);
+    uint32_t head = atomic_get(&imu_ring_head[pipe]);
+    int count = 0;
+
+    while (tail != head && count < max_samples)
+    {
+        samples[count++] = imu_ring[pipe][tail % CONTROLLER_IMU_RING_SIZE];
+        tail++;
+    }
+    atomic_set(&imu_ring_tail[pipe], tail);
+
+    return count;
+}
@@ -20,15 +20,84 @@ typedef struct
     int16_t gyroX;   // Gyroscope X
     int16_t gyroY;   // Gyroscope Y
     int16_t gyroZ;   // Gyroscope Z
+    uint8_t touch;        // Trackpad frame: latest gesture, finger count, gesture counter (ESB_TOUCH_*)
+    int16_t pad2X;        // Trackpad finger 2 X (0 when not touching)
+    int16_t pad2Y;        // Trackpad finger 2 Y
 } __packed controller_data_t;
 
-// ACK payload structure for timing control + rumble (lean design - 8 bytes total)
+// Variable-length wire format - must match controller side
+// Byte 0: bits 7-4 = wire version, bit 2 = IMU sequence restarted, bit 1 = touch block present,
+// bit 0 = keyframe (all fields present)
+// Byte 1: change mask, then each flagged field in mask bit order (little-endian), the touch block,
+// and the IMU batch last
+#define ESB_WIRE_VERSION         3
+#define ESB_WIRE_HEADER_SIZE     2
+#define ESB_WIRE_KEYFRAME        0x01
+#define ESB_WIRE_EXT_TOUCH       0x02
+#define ESB_WIRE_IMU_RESTART     0x04    // Controller booted - its IMU sequence numbers start over
+#define ESB_WIRE_FIELD_FLAGS     0x01    // flags (1 byte)
+#define ESB_WIRE_FIELD_TRIGGER   0x02    // trigger (1 byte)
+#define ESB_WIRE_FIELD_STICK     0x04    // stickX, stickY (2 bytes)
+#define ESB_WIRE_FIELD_PAD       0x08    // padX, padY (4 bytes)
+#define ESB_WIRE_FIELD_BUTTONS   0x10    // buttons (1 byte)
+#define ESB_WIRE_FIELD_ACCEL     0x20    // accelX/Y/Z (6 bytes)
+#define ESB_WIRE_FIELD_GYRO      0x40    // gyroX/Y/Z (6 bytes)
+#define ESB_WIRE_FIELD_ALL       0x7F
+#define ESB_WIRE_FIELD_IMU_BATCH 0x80    // IMU sample batch (last sample replaces accel/gyro)
+#define ESB_WIRE_MAX_SIZE        64      // Must not exceed CONFIG_ESB_MAX_PAYLOAD_LENGTH
+
+// Touch block: [touch][padStrength], then with two fingers [pad2X/pad2Y as 2 x 12 bits][pad2Strength]
+// The DS4 report has no pressure field, so the strength bytes are skipped
+#define ESB_TOUCH_GESTURE_MASK   0x0F    // iqs7211e_gestures_e of the latest gesture (0 = tap ... 12 = swipe-hold Y-)
+#define ESB_TOUCH_GESTURE_TAP    0       // IQS7211E single tap
+#define ESB_TOUCH_FINGERS_SHIFT  4
+#define ESB_TOUCH_FINGERS_MASK   0x30    // Fingers on the pad (0-2)
+#define ESB_TOUCH_COUNT_SHIFT    6
+#define ESB_TOUCH_COUNT_MASK     0xC0    // Gesture counter - a change means a new gesture
+#define ESB_TOUCH_FINGERS(touch) (((touch) & ESB_TOUCH_FINGERS_MASK) >> ESB_TOUCH_FINGERS_SHIFT)
+#define ESB_WIRE_TOUCH_SIZE(touch) (ESB_TOUCH_FINGERS(touch) >= 2 ? 6 : 2)
+
+// IMU batch: [first_seq][count][full_flags], sample 0 as 6 x int16, then each further sample as
+// 6 x int8 deltas to the previous one, or 6 x int16 if its bit in full_flags is set
+// Order per sample: accelX, accelY, accelZ, gyroX, gyroY, gyroZ
+#define ESB_WIRE_IMU_HEADER_SIZE 3
+#define ESB_WIRE_IMU_BATCH_MAX   8
+#define CONTROLLER_IMU_RING_SIZE 32      // Queue of received IMU samples (power of 2)
+#define CONTROLLER_IMU_PIPE      0       // Only the RIGHT half feeds the host IMU, so only its samples are queued
+#define CONTROLLER_IMU_PERIOD_US 2404    // Controller IMU sample period (416 Hz ODR)
+
+// One IMU sample as batched by the controller
+typedef struct
+{
+    int16_t accelX;
+    int16_t accelY;
+    int16_t accelZ;
+    int16_t gyroX;
+    int16_t gyroY;
+    int16_t gyroZ;
+    uint32_t timestamp_us;  // Dongle timebase estimate of when the sample was taken
+} __packed controller_imu_sample_t;
+
+// TDMA slot schedule - must match controller side
+// Each pipe owns one fixed slot per superframe: pipe 0 (RIGHT) at offset 0, pipe 1 (LEFT) at ESB_TDMA_SLOT_US.
+// 2000us superframe = 500Hz per half, 1kHz combined
+#define ESB_TDMA_SUPERFRAME_US   2000
+#define ESB_TDMA_SLOT_US         1000
+#define ESB_TDMA_NUM_SLOTS       2
+// Where inside its slot a packet should finish arriving (TX ramp-up + air time at 2Mbps)
+#define ESB_TDMA_ARRIVAL_OFFSET_US 300
+// Packets from different halves closer than this are counted as collisions
+#define ESB_TDMA_MIN_GAP_US      500
+
+// ACK payload structure for slot timing control + rumble (lean design - 12 bytes total)
 typedef struct
 {
-    uint16_t next_delay_ms;      // How long controller should wait before next transmission (0-65535ms)
+    uint16_t superframe_us;      // TDMA superframe length the controller should run at
+    int16_t slot_phase_us;       // Arrival of the measured packet relative to its slot target (+ = late, - = early)
     uint8_t sequence_num;        // Sequence tracking for debugging/sync
-    uint8_t rumble_data;         // Rumble intensity: bits 7-4=left motor, bits 3-0=right motor (0-15 each)
-    uint32_t dongle_timestamp;   // Dongle's current time for sync
+    uint8_t rumble;              // Motor amplitude for the half on this pipe (0 = off, 255 = full)
+    uint32_t dongle_timestamp;   // Dongle's microsecond timebase when the measured packet arrived
+    uint16_t rumble_age_us;      // Time from the host setting this amplitude to dongle_timestamp (saturates)
 } __packed ack_timing_data_t;
 
 // Simple controller state for dongle
@@ -47,15 +116,27 @@ typedef struct
     int16_t gyroX;
     int16_t gyroY;
     int16_t gyroZ;
+    uint8_t touch;          // ESB_TOUCH_* packed gesture/finger state
+    int16_t pad2X;
+    int16_t pad2Y;
     bool data_received;
     uint32_t last_ping_time;
+    uint32_t rx_time_us;        // Dongle microsecond timebase when the packet arrived
+    uint32_t sequence;          // Snapshots published for this half (increments per packet)
 } simple_controller_state_t;
 
+// Snapshots kept per half between the ESB ISR (producer) and the report thread (consumer)
+#define CONTROLLER_STATE_RING_SIZE 4
+
 // Function declarations
 int controller_esb_init(void);
-simple_controller_state_t *controller_esb_get_state(void);  // Legacy function - returns right controller
-simple_controller_state_t *controller_esb_get_left_state(void);   // Get left controller state
-simple_controller_state_t *controller_esb_get_right_state(void);  // Get right controller state
+bool controller_esb_get_snapshot(bool left, simple_controller_state_t *snapshot, uint32_t *overwritten);  // Freshest coherent state, false if none yet
+uint32_t controller_esb_get_overwritten_count(bool left);  // Snapshots superseded before they were read
+int controller_esb_wait_for_data(k_timeout_t timeout);     // 0 when a new snapshot arrived, -EAGAIN on timeout
+void controller_esb_clear_data_event(void);                // Discard a pending new-data wakeup
 bool controller_esb_has_new_data(void);
+uint32_t controller_esb_time_us(void);  // Dongle microsecond timebase (wraps every ~71 minutes)
+void controller_esb_set_rumble(bool left, uint8_t amplitude);  // Host motor amplitude for one half, rides on its next ACK payload
+int controller_esb_pop_imu_samples(bool left, controller_imu_sample_t *samples, int max_samples);  // Oldest first, returns count
 
 #endif // CONTROLLER_ESB_H
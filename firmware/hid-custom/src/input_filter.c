@@ -0,0 +1,97 @@
+#include "input_filter.h"
+#include <stdlib.h>
+
+// Q8 helpers - right shift of negative values is arithmetic on the toolchains we build with
+#define TO_Q8(x)       ((int32_t)(x) * 256)
+#define FROM_Q8(x)     (((x) + 128) >> 8)
+
+// Move state towards target by alpha/256
+static int32_t ema_step(int32_t state_q8, int32_t target_q8, uint16_t alpha_q8)
+{
+    return state_q8 + (((target_q8 - state_q8) * (int32_t)alpha_q8 + 128) >> 8);
+}
+
+void input_filter_init(input_filter_t *filter, const input_filter_config_t *cfg)
+{
+    filter->cfg = cfg;
+    input_filter_reset(filter);
+}
+
+void input_filter_reset(input_filter_t *filter)
+{
+    filter->value_q8 = 0;
+    filter->last_input_q8 = 0;
+    filter->speed_q8 = 0;
+    filter->primed = false;
+}
+
+int32_t input_filter_update(input_filter_t *filter, int32_t input)
+{
+    const input_filter_config_t *cfg = filter->cfg;
+    int32_t input_q8 = TO_Q8(input);
+
+    if (!filter->primed || cfg->type == INPUT_FILTER_NONE)
+    {
+        filter->value_q8 = input_q8;
+        filter->last_input_q8 = input_q8;
+        filter->speed_q8 = 0;
+        filter->primed = true;
+        return input;
+    }
+
+    switch (cfg->type)
+    {
+    case INPUT_FILTER_EMA:
+        filter->value_q8 = ema_step(filter->value_q8, input_q8, cfg->alpha_q8);
+        break;
+
+    case INPUT_FILTER_HYSTERESIS:
+        // Jump to the input once it leaves the band - small jitter never reaches the output
+        if (abs(input_q8 - filter->value_q8) > TO_Q8(cfg->threshold))
+        {
+            filter->value_q8 = input_q8;
+        }
+        break;
+
+    case INPUT_FILTER_ONE_EURO:
+    {
+        // Smoothed speed drives the cutoff: heavy smoothing at rest, none on fast moves
+        int32_t speed_q8 = abs(input_q8 - filter->last_input_q8);
+        filter->speed_q8 = ema_step(filter->speed_q8, speed_q8, cfg->d_alpha_q8);
+        filter->last_input_q8 = input_q8;
+
+        int32_t alpha = cfg->alpha_q8 + ((filter->speed_q8 * (int32_t)cfg->beta_q8) >> 8);
+        if (alpha > INPUT_FILTER_ALPHA_ONE)
+        {
+            alpha = INPUT_FILTER_ALPHA_ONE;
+        }
+        filter->value_q8 = ema_step(filter->value_q8, input_q8, (uint16_t)alpha);
+        break;
+    }
+
+    default:
+        filter->value_q8 = input_q8;
+        break;
+    }
+
+    return FROM_Q8(filter->value_q8);
+}
+
+uint32_t input_filter_latency_us(const input_filter_config_t *cfg, uint32_t update_interval_us)
+{
+    switch (cfg->type)
+    {
+    case INPUT_FILTER_EMA:
+    case INPUT_FILTER_ONE_EURO:
+        if (cfg->alpha_q8 == 0)
+        {
+            return UINT32_MAX;
+        }
+        // Single-pole IIR group delay at DC: (1 - a) / a updates
+        return (uint32_t)(((uint64_t)(INPUT_FILTER_ALPHA_ONE - cfg->alpha_q8) * update_interval_us +
+                           cfg->alpha_q8 / 2) / cfg->alpha_q8);
+
+    default:
+        return 0;
+    }
+}
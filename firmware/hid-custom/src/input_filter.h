@@ -0,0 +1,53 @@
+#ifndef INPUT_FILTER_H
+#define INPUT_FILTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Fixed-point per-axis input conditioning. All state is Q8 (value * 256) so a filter
+// works on any integer range (stick 0-255, trackpad 0-1919) without floats.
+// Filters advance once per update call - the dongle calls them once per new packet from the
+// controller half feeding the input, so the latency below is counted in updates
+// (input_filter_latency_us() converts at the packet interval).
+
+#define INPUT_FILTER_ALPHA_ONE 256  // Q8 weight of 1.0 - the newest sample replaces the state
+
+typedef enum
+{
+    INPUT_FILTER_NONE = 0,    // Pass-through, 0 updates latency
+    INPUT_FILTER_EMA,         // Single-pole IIR, (256 - alpha) / alpha updates group delay
+    INPUT_FILTER_HYSTERESIS,  // Hold output until input leaves +/-threshold, 0 updates latency
+    INPUT_FILTER_ONE_EURO,    // EMA whose alpha rises with speed: EMA latency at rest, ~0 when moving fast
+} input_filter_type_t;
+
+typedef struct
+{
+    input_filter_type_t type;
+    uint16_t alpha_q8;      // EMA weight of the new sample / One-Euro weight at rest (1-256)
+    uint16_t beta_q8;       // One-Euro: alpha added per input unit/update of speed
+    uint16_t d_alpha_q8;    // One-Euro: EMA weight for the speed estimate (1-256)
+    uint16_t threshold;     // Hysteresis band in input units
+} input_filter_config_t;
+
+typedef struct
+{
+    const input_filter_config_t *cfg;
+    int32_t value_q8;       // Filtered output
+    int32_t last_input_q8;  // Previous raw input (One-Euro speed)
+    int32_t speed_q8;       // Smoothed absolute speed per update (One-Euro)
+    bool primed;            // False until the first sample - that sample passes straight through
+} input_filter_t;
+
+// Bind a filter to its configuration and clear its state
+void input_filter_init(input_filter_t *filter, const input_filter_config_t *cfg);
+
+// Forget history so the next sample passes through (e.g. on a new touch)
+void input_filter_reset(input_filter_t *filter);
+
+// Feed one sample, returns the filtered value in the input's units
+int32_t input_filter_update(input_filter_t *filter, int32_t input);
+
+// Group delay of a configuration at rest in microseconds, for updates every update_interval_us
+uint32_t input_filter_latency_us(const input_filter_config_t *cfg, uint32_t update_interval_us);
+
+#endif // INPUT_FILTER_H
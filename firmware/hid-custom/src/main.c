@@ -5,206 +5,223 @@
 #include <zephyr/drivers/gpio.h>
 #include "controller_esb.h"
 #include "usb_hid_composite.h"
+#include "input_filter.h"
+#include "button_map.h"
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(main, LOG_LEVEL_INF);
 
-bool left_trackpad_pressed = false;
-bool right_trackpad_pressed = false;
+static const struct gpio_dt_spec led0 = GPIO_DT_SPEC_GET(DT_ALIAS(led0), gpios);
 
-bool left_mode_pressed = false;
-bool right_mode_pressed = false;
+// Report pacing - reports are triggered by controller packets, not a fixed timer
+#define REPORT_MIN_INTERVAL_US  1000    // One report per USB IN interval (in-polling-period-us in overlay)
+#define REPORT_IDLE_INTERVAL_MS 10      // Keep-alive report rate when no packets arrive
+#define REPORT_SOF_ALIGNED      1       // Build reports right after USB SOF instead of on packet arrival
+
+// A trackpad tap gesture clicks the DS4 touchpad for this long so the host sees press and release
+#define TAP_CLICK_US            50000
+#define DS4_BUTTONS2_TOUCHPAD   0x20    // buttons2 bit 5
+
+// Per-input conditioning, run once per new packet from the half that feeds the input.
+// Sticks: One-Euro - ~1.7 packets of smoothing at rest, none once the stick moves 2+ units per packet.
+static const input_filter_config_t stick_filter_cfg = {
+    .type = INPUT_FILTER_ONE_EURO,
+    .alpha_q8 = 96,
+    .beta_q8 = 80,
+    .d_alpha_q8 = 128,
+};
+
+// Trackpads: One-Euro - ~2.3 packets at rest to hide finger jitter, catches up on swipes.
+static const input_filter_config_t touch_filter_cfg = {
+    .type = INPUT_FILTER_ONE_EURO,
+    .alpha_q8 = 77,
+    .beta_q8 = 16,
+    .d_alpha_q8 = 128,
+};
+
+enum
+{
+    STICK_LEFT_X = 0,
+    STICK_LEFT_Y,
+    STICK_RIGHT_X,
+    STICK_RIGHT_Y,
+    STICK_AXIS_COUNT
+};
+
+enum
+{
+    TOUCH1_X = 0,
+    TOUCH1_Y,
+    TOUCH2_X,
+    TOUCH2_Y,
+    TOUCH_AXIS_COUNT
+};
+
+// What feeds a DS4 touch slot - a pad's second finger may borrow the other pad's idle slot
+typedef enum
+{
+    TOUCH_SOURCE_NONE = 0,
+    TOUCH_SOURCE_PAD,      // The slot's own pad, first finger
+    TOUCH_SOURCE_FINGER2,  // The other pad's second finger
+} touch_source_t;
+
+static input_filter_t stick_filters[STICK_AXIS_COUNT];
+static input_filter_t touch_filters[TOUCH_AXIS_COUNT];
+
+static void input_filters_init(void)
+{
+    for (int i = 0; i < STICK_AXIS_COUNT; i++)
+    {
+        input_filter_init(&stick_filters[i], &stick_filter_cfg);
+    }
+    for (int i = 0; i < TOUCH_AXIS_COUNT; i++)
+    {
+        input_filter_init(&touch_filters[i], &touch_filter_cfg);
+    }
+
+    // Filters advance per packet from their half - one packet per TDMA superframe
+    LOG_INF("Input filter delay at rest: sticks %uus, trackpads %uus (%uus per packet)",
+            input_filter_latency_us(&stick_filter_cfg, ESB_TDMA_SUPERFRAME_US),
+            input_filter_latency_us(&touch_filter_cfg, ESB_TDMA_SUPERFRAME_US), ESB_TDMA_SUPERFRAME_US);
+}
 
-static const struct gpio_dt_spec led0 = GPIO_DT_SPEC_GET(DT_ALIAS(led0), gpios);
 // Helper function to map a value from one range to another
 long map(long x, long in_min, long in_max, long out_min, long out_max)
 {
     return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
 }
 
+// Map a trackpad coordinate to the DS4 touch surface - left pad on the left half, right pad on the right
+static void map_pad_to_ds4(bool left, int16_t pad_x, int16_t pad_y, uint16_t *x, uint16_t *y)
+{
+    if (left)
+    {
+        *x = map(pad_y, 0, 1023, 959, 0);
+        *y = map(pad_x, 0, 1023, 0, 942);
+    }
+    else
+    {
+        *x = map(pad_y, 0, 1023, 0, 959) + 959;
+        *y = map(pad_x, 0, 1023, 942, 0);
+    }
+}
+
 // Convert controller data to HID reports (using separated controller states)
 static void process_controller_data(const struct device *hid_dev)
 {
     uint32_t func_start = k_uptime_get_32();
     
     // Get SEPARATE controller states - no more shared state corruption!
-    simple_controller_state_t *left_controller = controller_esb_get_left_state();
-    simple_controller_state_t *right_controller = controller_esb_get_right_state();
+    simple_controller_state_t left_snapshot, right_snapshot;
+    controller_esb_get_snapshot(true, &left_snapshot, NULL);
+    controller_esb_get_snapshot(false, &right_snapshot, NULL);
+    const simple_controller_state_t *left_controller = &left_snapshot;
+    const simple_controller_state_t *right_controller = &right_snapshot;
 
     // Static variables to hold complete state
-    static uint8_t dpad = 8;
-    static uint8_t buttons1 = 0, buttons2 = 0;
     static uint8_t left_x = 128, left_y = 128;
     static uint8_t right_x = 128, right_y = 128;
     static uint8_t left_trigger = 0, right_trigger = 0;
-    
-    // 4-point rolling average buffers for stick smoothing
-    static int16_t left_x_buffer[4] = {128, 128, 128, 128};
-    static int16_t left_y_buffer[4] = {128, 128, 128, 128};
-    static int16_t right_x_buffer[4] = {128, 128, 128, 128};
-    static int16_t right_y_buffer[4] = {128, 128, 128, 128};
-    static uint8_t stick_buffer_idx = 0;
-    
-    // Exponential smoothing for additional noise reduction
-    static float left_x_smooth = 128.0f;
-    static float left_y_smooth = 128.0f;
-    static float right_x_smooth = 128.0f;
-    static float right_y_smooth = 128.0f;
-    static const float alpha = 0.5f; // Smoothing factor (0.5 = balanced noise reduction with good responsiveness)
+
     static bool touch1_active = false;
     static bool touch2_active = false;
     static uint16_t touch1_x = 0, touch1_y = 0;
     static uint16_t touch2_x = 0, touch2_y = 0;
     static int16_t accel_x = 0, accel_y = 0, accel_z = 0;
     static int16_t gyro_x = 0, gyro_y = 0, gyro_z = 0;
+    static uint32_t imu_time_us = 0;
 
     static uint16_t raw_touch2_x = 0;
     static uint16_t raw_touch2_y = 0;
-
-    static uint16_t last_touch2_x = 0, last_touch2_y = 0;
-    static bool last_touch2_active = false;
-    static float interp_factor = 0.7f; // Adjust for smoothness
+    static touch_source_t last_touch2_source = TOUCH_SOURCE_NONE;
 
     static uint16_t raw_touch_x = 0;
     static uint16_t raw_touch_y = 0;
+    static touch_source_t last_touch_source = TOUCH_SOURCE_NONE;
+
+    // Second finger on each pad, already mapped to the DS4 surface
+    static bool left_finger2_active = false, right_finger2_active = false;
+    static uint16_t left_finger2_x = 0, left_finger2_y = 0;
+    static uint16_t right_finger2_x = 0, right_finger2_y = 0;
 
-    // Static variables for interpolation
-    static uint16_t last_touch_x = 0, last_touch_y = 0;
-    static bool last_touch_active = false;
+    // Reports also go out when only the other half sent - filters only take a half's new packets,
+    // otherwise a repeated sample would tie their cutoff to the other controller's traffic
+    static uint32_t left_sequence = 0, right_sequence = 0;
+    bool left_new = left_controller->data_received && left_controller->sequence != left_sequence;
+    bool right_new = right_controller->data_received && right_controller->sequence != right_sequence;
 
     // Process LEFT controller data independently
     if (left_controller->data_received)
     {
-        // Left controller data with 4-point rolling average
-        left_x_buffer[stick_buffer_idx] = left_controller->stickX + 128;
-        left_y_buffer[stick_buffer_idx] = left_controller->stickY + 128;
-        int16_t left_x_avg = (left_x_buffer[0] + left_x_buffer[1] + left_x_buffer[2] + left_x_buffer[3]) / 4;
-        int16_t left_y_avg = (left_y_buffer[0] + left_y_buffer[1] + left_y_buffer[2] + left_y_buffer[3]) / 4;
-        
-        // Apply exponential smoothing: output = alpha * new_value + (1 - alpha) * old_value
-        left_x_smooth = alpha * left_x_avg + (1.0f - alpha) * left_x_smooth;
-        left_y_smooth = alpha * left_y_avg + (1.0f - alpha) * left_y_smooth;
-        left_x = (uint8_t)(left_x_smooth + 0.5f); // Round to nearest
-        left_y = (uint8_t)(left_y_smooth + 0.5f);
+        // Left stick through its conditioning filters, holding the last output until a new packet
+        if (left_new)
+        {
+            left_x = (uint8_t)CLAMP(input_filter_update(&stick_filters[STICK_LEFT_X], left_controller->stickX + 128), 0, 255);
+            left_y = (uint8_t)CLAMP(input_filter_update(&stick_filters[STICK_LEFT_Y], left_controller->stickY + 128), 0, 255);
+        }
         left_trigger = left_controller->trigger;
 
         // Touchpad from left controller
         touch2_active = (left_controller->padX != 0 || left_controller->padY != 0);
 
         // Raw trackpad values after mapping
-        raw_touch2_x = touch2_active ? (map(left_controller->padY, 0, 1023, 959, 0)) : 0;
-        raw_touch2_y = touch2_active ? (map(left_controller->padX, 0, 1023, 0, 942)) : 0;
-
-        // Left controller Dpad processing
-        if ((left_controller->buttons & 0x08) && !(left_controller->buttons & 0x04) && !(left_controller->buttons & 0x02) && !(left_controller->buttons & 0x01)) // just down
-        {
-            dpad = 4; // Down
-        }
-        if (!(left_controller->buttons & 0x08) && (left_controller->buttons & 0x04) && !(left_controller->buttons & 0x02) && !(left_controller->buttons & 0x01)) // just right
-        {
-            dpad = 2; // Right
-        }
-        if (!(left_controller->buttons & 0x08) && !(left_controller->buttons & 0x04) && (left_controller->buttons & 0x02) && !(left_controller->buttons & 0x01)) // just left
-        {
-            dpad = 6; // Left
-        }
-        if (!(left_controller->buttons & 0x08) && !(left_controller->buttons & 0x04) && !(left_controller->buttons & 0x02) && (left_controller->buttons & 0x01)) // just up
-        {
-            dpad = 0; // Up
-        }
-        if ((left_controller->buttons & 0x08) && (left_controller->buttons & 0x04) && !(left_controller->buttons & 0x02) && !(left_controller->buttons & 0x01)) // down right
-        {
-            dpad = 3; // Down Right
-        }
-        if (!(left_controller->buttons & 0x08) && (left_controller->buttons & 0x04) && !(left_controller->buttons & 0x02) && (left_controller->buttons & 0x01)) // right up
-        {
-            dpad = 1; // Right Up
-        }
-        if ((left_controller->buttons & 0x08) && !(left_controller->buttons & 0x04) && (left_controller->buttons & 0x02) && !(left_controller->buttons & 0x01)) // down left
-        {
-            dpad = 5; // Left Down
-        }
-        if (!(left_controller->buttons & 0x08) && !(left_controller->buttons & 0x04) && (left_controller->buttons & 0x02) && (left_controller->buttons & 0x01)) // left up
-        {
-            dpad = 7; // Up Left
-        }
-        if (!(left_controller->buttons & 0x08) && !(left_controller->buttons & 0x04) && !(left_controller->buttons & 0x02) && !(left_controller->buttons & 0x01)) // neutral
-        {
-            dpad = 8; // neutral
-        }
-
-        // Left controller buttons
-        if (left_controller->buttons & 0x10 || left_controller->flags & 0x01) // 0x01 is P5 just hard coding it for now
-        {
-            buttons1 |= (1 << 4); // Bumper
-        }
-        else
-        {
-            buttons1 &= ~(1 << 4); // Bumper
-        }
-
-        if (left_controller->buttons & 0x40)
-        {
-            buttons2 |= (1 << 5); // Trackpad Click
-            left_trackpad_pressed = true;
-        }
-        else
+        raw_touch2_x = 0;
+        raw_touch2_y = 0;
+        if (touch2_active)
         {
-            left_trackpad_pressed = false;
+            map_pad_to_ds4(true, left_controller->padX, left_controller->padY, &raw_touch2_x, &raw_touch2_y);
         }
 
-        if (left_controller->buttons & 0x20 || left_controller->flags & 0x02) // 0x02 is P4 just hard coding it for now
-        {
-            buttons2 |= (1 << 2); // Stick Click
-        }
-        else
+        left_finger2_active = ESB_TOUCH_FINGERS(left_controller->touch) >= 2;
+        if (left_finger2_active)
         {
-            buttons2 &= ~(1 << 2); // Stick Click
+            map_pad_to_ds4(true, left_controller->pad2X, left_controller->pad2Y, &left_finger2_x, &left_finger2_y);
         }
+    }
 
-        if (left_controller->buttons & 0x80)
-        {
-            buttons2 |= (1 << 0); // Select
-        }
-        else
+    // Process RIGHT controller data independently
+    if (right_controller->data_received)
+    {
+        // Right stick through its conditioning filters, holding the last output until a new packet
+        if (right_new)
         {
-            buttons2 &= ~(1 << 0); // Select
+            right_x = (uint8_t)CLAMP(input_filter_update(&stick_filters[STICK_RIGHT_X], right_controller->stickX + 128), 0, 255);
+            right_y = (uint8_t)CLAMP(input_filter_update(&stick_filters[STICK_RIGHT_Y], right_controller->stickY + 128), 0, 255);
         }
+        right_trigger = right_controller->trigger;
 
-        if (left_controller->flags & 0x40)
-        {
-            buttons2 |= (1 << 4); // PS button
-            left_mode_pressed = true;
+        // IMU from right controller only - consume every batched sample since the last report in order.
+        // Gyro is averaged so the rotation the host integrates over the report interval is preserved,
+        // accel uses the newest sample. With no new samples the last received state is held.
+        controller_imu_sample_t imu_samples[CONTROLLER_IMU_RING_SIZE];
+        int imu_count = controller_esb_pop_imu_samples(false, imu_samples, ARRAY_SIZE(imu_samples));
+        if (imu_count > 0)
+        {
+            int32_t gyro_sum_x = 0, gyro_sum_y = 0, gyro_sum_z = 0;
+            for (int i = 0; i < imu_count; i++)
+            {
+                gyro_sum_x += imu_samples[i].gyroX;
+                gyro_sum_y += imu_samples[i].gyroY;
+                gyro_sum_z += imu_samples[i].gyroZ;
+            }
+            accel_x = imu_samples[imu_count - 1].accelX;
+            accel_y = imu_samples[imu_count - 1].accelY;
+            accel_z = imu_samples[imu_count - 1].accelZ;
+            gyro_x = gyro_sum_x / imu_count;
+            gyro_y = gyro_sum_y / imu_count;
+            gyro_z = gyro_sum_z / imu_count;
+            imu_time_us = imu_samples[imu_count - 1].timestamp_us;
         }
         else
         {
-            left_mode_pressed = false;
+            accel_x = right_controller->accelX;
+            accel_y = right_controller->accelY;
+            accel_z = right_controller->accelZ;
+            gyro_x = right_controller->gyroX;
+            gyro_y = right_controller->gyroY;
+            gyro_z = right_controller->gyroZ;
+            imu_time_us = right_controller->rx_time_us;
         }
-    }
-
-    // Process RIGHT controller data independently
-    if (right_controller->data_received)
-    {
-        // Right controller data with 4-point rolling average
-        right_x_buffer[stick_buffer_idx] = right_controller->stickX + 128;
-        right_y_buffer[stick_buffer_idx] = right_controller->stickY + 128;
-        int16_t right_x_avg = (right_x_buffer[0] + right_x_buffer[1] + right_x_buffer[2] + right_x_buffer[3]) / 4;
-        int16_t right_y_avg = (right_y_buffer[0] + right_y_buffer[1] + right_y_buffer[2] + right_y_buffer[3]) / 4;
-        
-        // Apply exponential smoothing: output = alpha * new_value + (1 - alpha) * old_value
-        right_x_smooth = alpha * right_x_avg + (1.0f - alpha) * right_x_smooth;
-        right_y_smooth = alpha * right_y_avg + (1.0f - alpha) * right_y_smooth;
-        right_x = (uint8_t)(right_x_smooth + 0.5f); // Round to nearest
-        right_y = (uint8_t)(right_y_smooth + 0.5f);
-        right_trigger = right_controller->trigger;
-
-        // IMU from right controller only
-        accel_x = right_controller->accelX;
-        accel_y = right_controller->accelY;
-        accel_z = right_controller->accelZ;
-        gyro_x = right_controller->gyroX;
-        gyro_y = right_controller->gyroY;
-        gyro_z = right_controller->gyroZ;
 
         gyro_y = -gyro_y;
         accel_y = -accel_y;
@@ -213,154 +230,153 @@ static void process_controller_data(const struct device *hid_dev)
         touch1_active = (right_controller->padX != 0 || right_controller->padY != 0);
         
         // Raw trackpad values after mapping
-        raw_touch_x = touch1_active ? (map(right_controller->padY, 0, 1023, 0, 959) + 959) : 0;
-        raw_touch_y = touch1_active ? (map(right_controller->padX, 0, 1023, 942, 0)) : 0;
-
-        // Right controller buttons
-        if (right_controller->buttons & 0x01)
-        {
-            buttons1 |= (1 << 3); // Y
-        }
-        else
-        {
-            buttons1 &= ~(1 << 3); // Y
-        }
-
-        if (right_controller->buttons & 0x02)
-        {
-            buttons1 |= (1 << 0); // X
-        }
-        else
-        {
-            buttons1 &= ~(1 << 0); // X
-        }
-
-        if (right_controller->buttons & 0x04)
-        {
-            buttons1 |= (1 << 2); // B
-        }
-        else
+        raw_touch_x = 0;
+        raw_touch_y = 0;
+        if (touch1_active)
         {
-            buttons1 &= ~(1 << 2); // B
+            map_pad_to_ds4(false, right_controller->padX, right_controller->padY, &raw_touch_x, &raw_touch_y);
         }
 
-        if (right_controller->buttons & 0x08 || right_controller->flags & 0x01) // 0x01 is P5 just hard coding it for now
+        right_finger2_active = ESB_TOUCH_FINGERS(right_controller->touch) >= 2;
+        if (right_finger2_active)
         {
-            buttons1 |= (1 << 1); // A
-        }
-        else
-        {
-            buttons1 &= ~(1 << 1); // A
+            map_pad_to_ds4(false, right_controller->pad2X, right_controller->pad2Y, &right_finger2_x, &right_finger2_y);
         }
+    }
 
-        if (right_controller->buttons & 0x10)
+    // Buttons from both halves through the precomputed lookup tables
+    ds4_buttons_t ds4_buttons;
+    button_map_decode(left_controller->data_received ? button_map_inputs(left_controller->buttons, left_controller->flags) : 0,
+                      right_controller->data_received ? button_map_inputs(right_controller->buttons, right_controller->flags) : 0,
+                      &ds4_buttons);
+
+    // Tap-to-click: a new tap on either pad (its gesture counter moved) presses the touchpad button
+    static uint8_t last_gesture_count[2];
+    static bool gesture_count_valid[2];
+    static uint32_t tap_click_until_us;
+    const simple_controller_state_t *halves[2] = {right_controller, left_controller};
+    uint32_t tap_now_us = controller_esb_time_us();
+    for (int half = 0; half < 2; half++)
+    {
+        if (!halves[half]->data_received)
         {
-            buttons1 |= (1 << 5); // Bumper
+            continue;
         }
-        else
+        uint8_t count = halves[half]->touch & ESB_TOUCH_COUNT_MASK;
+        if (gesture_count_valid[half] && count != last_gesture_count[half] &&
+            (halves[half]->touch & ESB_TOUCH_GESTURE_MASK) == ESB_TOUCH_GESTURE_TAP)
         {
-            buttons1 &= ~(1 << 5); // Bumper
+            tap_click_until_us = tap_now_us + TAP_CLICK_US;
         }
+        last_gesture_count[half] = count;
+        gesture_count_valid[half] = true;
+    }
+    if ((int32_t)(tap_click_until_us - tap_now_us) > 0)
+    {
+        ds4_buttons.buttons2 |= DS4_BUTTONS2_TOUCHPAD;
+    }
 
-        if (right_controller->buttons & 0x20 || right_controller->flags & 0x02) // 0x02 is P4 just hard coding it for now
-        {
-            buttons2 |= (1 << 3); // Stick Click
-        }
-        else
-        {
-            buttons2 &= ~(1 << 3); // Stick Click
-        }
+    // DS4 has two touch slots: slot 1 is the right pad, slot 2 the left pad. While one pad is idle
+    // the other pad's second finger takes its slot so two-finger gestures reach the host.
+    touch_source_t touch_source = touch1_active ? TOUCH_SOURCE_PAD : TOUCH_SOURCE_NONE;
+    bool slot1_active = touch1_active;
+    uint16_t slot1_x = raw_touch_x, slot1_y = raw_touch_y;
+    if (!touch1_active && left_finger2_active)
+    {
+        touch_source = TOUCH_SOURCE_FINGER2;
+        slot1_active = true;
+        slot1_x = left_finger2_x;
+        slot1_y = left_finger2_y;
+    }
 
-        if (right_controller->buttons & 0x40)
-        {
-            buttons2 |= (1 << 5); // Trackpad Click
-            right_trackpad_pressed = true;
-        }
-        else
-        {
-            right_trackpad_pressed = false;
-        }
+    touch_source_t touch2_source = touch2_active ? TOUCH_SOURCE_PAD : TOUCH_SOURCE_NONE;
+    bool slot2_active = touch2_active;
+    uint16_t slot2_x = raw_touch2_x, slot2_y = raw_touch2_y;
+    if (!touch2_active && right_finger2_active)
+    {
+        touch2_source = TOUCH_SOURCE_FINGER2;
+        slot2_active = true;
+        slot2_x = right_finger2_x;
+        slot2_y = right_finger2_y;
+    }
 
-        if (right_controller->buttons & 0x80)
+    // Trackpad conditioning - a new touch (or a slot changing finger) restarts the filters so it
+    // lands exactly where the finger is. Otherwise a slot only advances on a new packet from the
+    // half its finger is on (slot 1: right pad or left second finger, slot 2 the other way round)
+    bool slot1_new = (touch_source == TOUCH_SOURCE_PAD) ? right_new : left_new;
+    if (slot1_active)
+    {
+        if (touch_source != last_touch_source)
         {
-            buttons2 |= (1 << 1); // Start
+            input_filter_reset(&touch_filters[TOUCH1_X]);
+            input_filter_reset(&touch_filters[TOUCH1_Y]);
+            slot1_new = true;
         }
-        else
+        if (slot1_new)
         {
-            buttons2 &= ~(1 << 1); // Start
+            touch1_x = (uint16_t)input_filter_update(&touch_filters[TOUCH1_X], slot1_x);
+            touch1_y = (uint16_t)input_filter_update(&touch_filters[TOUCH1_Y], slot1_y);
         }
+    }
+    else
+    {
+        touch1_x = slot1_x;
+        touch1_y = slot1_y;
+    }
+    last_touch_source = touch_source;
 
-        if (right_controller->flags & 0x40)
+    bool slot2_new = (touch2_source == TOUCH_SOURCE_PAD) ? left_new : right_new;
+    if (slot2_active)
+    {
+        if (touch2_source != last_touch2_source)
         {
-            buttons2 |= (1 << 4); // Guide button
-            buttons1 |= (1 << 1); // A
-            right_mode_pressed = true;
+            input_filter_reset(&touch_filters[TOUCH2_X]);
+            input_filter_reset(&touch_filters[TOUCH2_Y]);
+            slot2_new = true;
         }
-        else
+        if (slot2_new)
         {
-            right_mode_pressed = false;
+            touch2_x = (uint16_t)input_filter_update(&touch_filters[TOUCH2_X], slot2_x);
+            touch2_y = (uint16_t)input_filter_update(&touch_filters[TOUCH2_Y], slot2_y);
         }
     }
-
-    // Handle trackpad and mode button combinations
-    if (!left_trackpad_pressed && !right_trackpad_pressed)
-    {
-        buttons2 &= ~(1 << 5);
-    }
-
-    if (!left_mode_pressed && !right_mode_pressed)
+    else
     {
-        buttons2 &= ~(1 << 4); // Clear PS/Guide button
+        touch2_x = slot2_x;
+        touch2_y = slot2_y;
     }
+    last_touch2_source = touch2_source;
 
-    if (touch1_active && last_touch_active)
+    if (left_new)
     {
-        // Interpolate between last and current position
-        touch1_x = (uint16_t)(last_touch_x * interp_factor + raw_touch_x * (1.0f - interp_factor));
-        touch1_y = (uint16_t)(last_touch_y * interp_factor + raw_touch_y * (1.0f - interp_factor));
+        left_sequence = left_controller->sequence;
     }
-    else
+    if (right_new)
     {
-        // First touch or touch just started
-        touch1_x = raw_touch_x;
-        touch1_y = raw_touch_y;
+        right_sequence = right_controller->sequence;
     }
 
-    // Store for next frame
-    last_touch_x = touch1_x;
-    last_touch_y = touch1_y;
-    last_touch_active = touch1_active;
-
-    if (touch2_active && last_touch2_active)
+    // Age of the newest controller data going into this report
+    uint32_t data_age_us = USB_HID_DATA_AGE_NONE;
+    uint32_t now_us = controller_esb_time_us();
+    if (left_controller->data_received)
     {
-        // Interpolate between last and current position
-        touch2_x = (uint16_t)(last_touch2_x * interp_factor + raw_touch2_x * (1.0f - interp_factor));
-        touch2_y = (uint16_t)(last_touch2_y * interp_factor + raw_touch2_y * (1.0f - interp_factor));
+        data_age_us = now_us - left_controller->rx_time_us;
     }
-    else
+    if (right_controller->data_received)
     {
-        // First touch or touch just started
-        touch2_x = raw_touch2_x;
-        touch2_y = raw_touch2_y;
+        data_age_us = MIN(data_age_us, now_us - right_controller->rx_time_us);
     }
 
-    // Store for next frame
-    last_touch2_x = touch2_x;
-    last_touch2_y = touch2_y;
-    last_touch2_active = touch2_active;
-    // With interp(end)
-    
-    // Update stick buffer index for rolling average (circular buffer)
-    stick_buffer_idx = (stick_buffer_idx + 1) % 4;
-
     // Send the report (same as before)
-    usb_hid_send_ds4_report_with_touchpad_and_imu(hid_dev, dpad, buttons1, buttons2,
+    usb_hid_send_ds4_report_with_touchpad_and_imu(hid_dev, ds4_buttons.dpad, ds4_buttons.buttons1, ds4_buttons.buttons2,
                                                   left_x, left_y, right_x, right_y,
                                                   left_trigger, right_trigger,
-                                                  touch1_active, touch1_x, touch1_y,
-                                                  touch2_active, touch2_x, touch2_y,
+                                                  slot1_active, touch1_x, touch1_y,
+                                                  slot2_active, touch2_x, touch2_y,
                                                   accel_x, accel_y, accel_z,
-                                                  gyro_x, gyro_y, gyro_z);
+                                                  gyro_x, gyro_y, gyro_z, imu_time_us,
+                                                  data_age_us);
                                                   
     // Log function timing if it's slow
     uint32_t func_time = k_uptime_get_32() - func_start;
@@ -369,6 +385,13 @@ static void process_controller_data(const struct device *hid_dev)
     }
 }
 
+// Host rumble - the DS4 strong (left) motor drives the left half, the weak (right) motor the right half
+static void host_rumble_handler(uint8_t left, uint8_t right)
+{
+    controller_esb_set_rumble(true, left);
+    controller_esb_set_rumble(false, right);
+}
+
 int main(void)
 {
     const struct device *hid_dev;
@@ -411,33 +434,50 @@ int main(void)
         return 0;
     }
 
+    // Motor values ride on the ACK payloads, so only forward them once ESB is up
+    usb_hid_set_rumble_callback(host_rumble_handler);
+
     // LOG_INF("Waiting for radio to fully initialize...");
     k_sleep(K_MSEC(500));
     // LOG_INF("Starting ESB ping loop");
 
-    // Main loop - poll controllers and process responses
-    uint32_t heartbeat_timer = 0;
-    uint32_t last_report_time = 0;
-    uint32_t last_ping_time = 0;
+    input_filters_init();
+    button_map_init();
+
+    // Main loop - build a report as soon as a controller packet arrives
+    uint32_t last_report_us = controller_esb_time_us() - REPORT_MIN_INTERVAL_US;
 
     while (true)
     {
-        uint32_t now = k_uptime_get_32();
-        uint32_t loop_start = now;
-
-        if (now - last_report_time >= 4)
-        { // 250Hz (4ms)
-            last_report_time = now;
-        //     uint32_t process_start = k_uptime_get_32();
-            process_controller_data(hid_dev);
-        //     uint32_t process_end = k_uptime_get_32();
-            
-            // Log if processing takes too long
-            // uint32_t process_time = process_end - process_start;
-            // if (process_time > 5) { // Only warn if processing takes over 5ms (was 2ms)
-            //     LOG_WRN("Long processing time: %dms", process_time);
-            // }
+#if REPORT_SOF_ALIGNED
+        // Wake on SOF so the report is assembled from the freshest state just before this frame's IN poll
+        usb_hid_wait_for_sof(K_MSEC(REPORT_IDLE_INTERVAL_MS));
+
+        uint32_t loop_start = k_uptime_get_32();
+
+        // Only rebuild when a packet arrived since the last report, or as a keep-alive
+        bool new_data = controller_esb_wait_for_data(K_NO_WAIT) == 0;
+        if (!new_data && controller_esb_time_us() - last_report_us < REPORT_IDLE_INTERVAL_MS * 1000)
+        {
+            continue;
         }
+#else
+        // Sleep until the radio publishes new data; the idle timeout keeps reports flowing with no controllers
+        controller_esb_wait_for_data(K_MSEC(REPORT_IDLE_INTERVAL_MS));
+
+        uint32_t loop_start = k_uptime_get_32();
+
+        // Coalesce: at most one report per USB interval - packets arriving meanwhile land in this report
+        uint32_t since_report_us = controller_esb_time_us() - last_report_us;
+        if (since_report_us < REPORT_MIN_INTERVAL_US)
+        {
+            k_sleep(K_USEC(REPORT_MIN_INTERVAL_US - since_report_us));
+        }
+        controller_esb_clear_data_event();
+#endif
+
+        last_report_us = controller_esb_time_us();
+        process_controller_data(hid_dev);
 
         // Log if entire loop iteration takes too long
         uint32_t loop_end = k_uptime_get_32();
@@ -445,9 +485,6 @@ int main(void)
         if (loop_time > 10) { // Only warn if loop takes over 10ms (was 3ms)
             LOG_WRN("Long loop time: %dms", loop_time);
         }
-
-        // Small delay to prevent overwhelming the system
-        k_sleep(K_USEC(250));
     }
     return 0;
 }
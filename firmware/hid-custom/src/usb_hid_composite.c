@@ -319,11 +319,59 @@ static const uint8_t hid_report_desc[] =
         0xC0,       // End Collection
 };
 
-static K_SEM_DEFINE(ep_write_sem, 0, 1);
 static const struct device *hid_device = NULL;
 
+// Non-blocking IN report pipeline: one pending buffer per report ID plus the buffer the
+// controller is currently reading. Producers overwrite their pending buffer with the newest
+// state; whatever is pending goes out when the previous transfer completes.
+#define HID_IN_REPORT_MAX_SIZE 64
+
+enum hid_in_slot_id
+{
+    HID_IN_SLOT_DS4 = 0,
+    HID_IN_SLOT_MOUSE,
+    HID_IN_SLOT_KEYBOARD,
+    HID_IN_SLOT_COUNT
+};
+
+typedef struct
+{
+    uint8_t data[HID_IN_REPORT_MAX_SIZE];
+    uint8_t len;
+    bool pending;
+    uint32_t data_age_us; // Age of the controller data when the report was queued
+    uint32_t queued_cyc;  // Cycle count at queue time, to extend the age up to submission
+} hid_in_slot_t;
+
+static hid_in_slot_t hid_in_slots[HID_IN_SLOT_COUNT];
+static uint8_t hid_in_inflight[HID_IN_REPORT_MAX_SIZE]; // Owned by the USB stack while hid_in_busy
+static uint8_t hid_in_inflight_slot;
+static uint8_t hid_in_next_slot;                         // Round-robin start so DS4 can't starve mouse/keyboard
+static bool hid_in_busy;
+static struct k_spinlock hid_in_lock;
+
+// Start-of-frame signal for SOF-aligned report assembly
+static K_SEM_DEFINE(sof_sem, 0, 1);
+
+// Report pipeline counters (protected by hid_in_lock)
+static usb_hid_report_stats_t hid_in_stats;
+static uint32_t rate_window_start;
+static uint32_t rate_window_count;
+
+// DS4 output report 0x05, offsets after the report ID
+#define DS4_OUTPUT_REPORT_ID      0x05
+#define DS4_OUTPUT_REPORT_SIZE    31
+#define DS4_OUT_FLAGS             0     // Bit 0 = motor values valid, bit 1 = lightbar, bit 2 = flash
+#define DS4_OUT_FLAG_RUMBLE       0x01
+#define DS4_OUT_RUMBLE_RIGHT      3     // Weak / high frequency motor
+#define DS4_OUT_RUMBLE_LEFT       4     // Strong / low frequency motor
+
+static usb_hid_rumble_cb_t rumble_cb;
+
 // Global DS4 counters (shared between both report functions)
 static uint16_t ds4_timestamp_counter = 0;
+static uint32_t ds4_timestamp_imu_us = 0;   // IMU sample time the counter was last advanced to
+static uint8_t ds4_timestamp_frac = 0;      // Remainder in 1/16 DS4 units
 static uint8_t ds4_frame_counter = 0;
 static uint8_t ds4_touch_counter = 0;
 
@@ -397,10 +445,136 @@ static int enable_usb_device_next(void)
     return 0;
 }
 
+// Submit the next pending report if the IN endpoint is idle
+static void hid_in_kick(const struct device *dev)
+{
+    k_spinlock_key_t key = k_spin_lock(&hid_in_lock);
+
+    if (hid_in_busy)
+    {
+        k_spin_unlock(&hid_in_lock, key);
+        return;
+    }
+
+    hid_in_slot_t *slot = NULL;
+    for (int i = 0; i < HID_IN_SLOT_COUNT; i++)
+    {
+        uint8_t id = (hid_in_next_slot + i) % HID_IN_SLOT_COUNT;
+        if (hid_in_slots[id].pending)
+        {
+            slot = &hid_in_slots[id];
+            hid_in_inflight_slot = id;
+            hid_in_next_slot = (id + 1) % HID_IN_SLOT_COUNT;
+            break;
+        }
+    }
+
+    if (slot == NULL)
+    {
+        k_spin_unlock(&hid_in_lock, key);
+        return;
+    }
+
+    uint8_t len = slot->len;
+    memcpy(hid_in_inflight, slot->data, len);
+    slot->pending = false;
+    hid_in_busy = true;
+
+    if (hid_in_inflight_slot == HID_IN_SLOT_DS4 && slot->data_age_us != USB_HID_DATA_AGE_NONE)
+    {
+        uint32_t age = slot->data_age_us + k_cyc_to_us_floor32(k_cycle_get_32() - slot->queued_cyc);
+        hid_in_stats.data_age_us = age;
+        hid_in_stats.data_age_max_us = MAX(hid_in_stats.data_age_max_us, age);
+        // Running average with 1/16 weight - cheap and good enough to watch trends
+        hid_in_stats.data_age_avg_us += ((int32_t)age - (int32_t)hid_in_stats.data_age_avg_us) / 16;
+    }
+    k_spin_unlock(&hid_in_lock, key);
+
+    // The stack may sleep here, so submit outside the spinlock - hid_in_busy guards the buffer
+    int ret = hid_int_ep_write(dev, hid_in_inflight, len, NULL);
+    if (ret != 0)
+    {
+        key = k_spin_lock(&hid_in_lock);
+        hid_in_busy = false;
+        // Put the report back unless a newer one already replaced it (e.g. a key release)
+        slot = &hid_in_slots[hid_in_inflight_slot];
+        if (!slot->pending)
+        {
+            memcpy(slot->data, hid_in_inflight, len);
+            slot->pending = true;
+        }
+        k_spin_unlock(&hid_in_lock, key);
+        // LOG_DBG("HID write failed: %d", ret);
+    }
+}
+
+// Store a report as the pending one for its slot - caller holds hid_in_lock
+static void hid_in_store_report(enum hid_in_slot_id id, const uint8_t *report, uint8_t len, uint32_t data_age_us)
+{
+    memcpy(hid_in_slots[id].data, report, len);
+    hid_in_slots[id].len = len;
+    hid_in_slots[id].pending = true;
+    hid_in_slots[id].data_age_us = data_age_us;
+    hid_in_slots[id].queued_cyc = k_cycle_get_32();
+}
+
+// Replace the pending report for a slot with the newest state and try to send it
+static void hid_in_queue_report(const struct device *dev, enum hid_in_slot_id id, const uint8_t *report, uint8_t len,
+                                uint32_t data_age_us)
+{
+    k_spinlock_key_t key = k_spin_lock(&hid_in_lock);
+    hid_in_store_report(id, report, len, data_age_us);
+    k_spin_unlock(&hid_in_lock, key);
+
+    hid_in_kick(dev);
+}
+
 static void int_in_ready_cb(const struct device *dev)
+{
+    uint32_t now = k_uptime_get_32();
+
+    k_spinlock_key_t key = k_spin_lock(&hid_in_lock);
+    hid_in_busy = false;
+    hid_in_stats.reports_sent++;
+
+    // Achieved report rate over a one second window
+    rate_window_count++;
+    uint32_t window_ms = now - rate_window_start;
+    if (window_ms >= 1000)
+    {
+        hid_in_stats.report_rate_hz = rate_window_count * 1000 / window_ms;
+        rate_window_count = 0;
+        rate_window_start = now;
+    }
+    k_spin_unlock(&hid_in_lock, key);
+
+    hid_in_kick(dev);
+}
+
+static void sof_cb(const struct device *dev)
 {
     ARG_UNUSED(dev);
-    k_sem_give(&ep_write_sem);
+
+    // Same lock as the other counters so a stats snapshot never sees a torn update
+    k_spinlock_key_t key = k_spin_lock(&hid_in_lock);
+    hid_in_stats.sof_count++;
+    k_spin_unlock(&hid_in_lock, key);
+
+    k_sem_give(&sof_sem);
+}
+
+// Block until the next USB start-of-frame (or timeout)
+int usb_hid_wait_for_sof(k_timeout_t timeout)
+{
+    return k_sem_take(&sof_sem, timeout);
+}
+
+// Snapshot of the report pipeline counters
+void usb_hid_get_report_stats(usb_hid_report_stats_t *stats)
+{
+    k_spinlock_key_t key = k_spin_lock(&hid_in_lock);
+    *stats = hid_in_stats;
+    k_spin_unlock(&hid_in_lock, key);
 }
 
 // Feature report callback for HID Get Report requests
@@ -499,6 +673,38 @@ static int get_report_cb(const struct device *dev, uint8_t type, uint8_t id, uin
     return -ENOTSUP;
 }
 
+// Parse a DS4 output report 0x05 (with or without its report ID byte) and forward the motor values
+static void ds4_handle_output_report(const uint8_t *buf, uint16_t len)
+{
+    // Interrupt OUT transfers and most hosts' SET_REPORT data keep the report ID in front
+    if (len > DS4_OUTPUT_REPORT_SIZE && buf[0] == DS4_OUTPUT_REPORT_ID)
+    {
+        buf++;
+        len--;
+    }
+    if (len <= DS4_OUT_RUMBLE_LEFT || !(buf[DS4_OUT_FLAGS] & DS4_OUT_FLAG_RUMBLE))
+    {
+        return;
+    }
+
+    usb_hid_rumble_cb_t cb = rumble_cb;
+    if (cb)
+    {
+        cb(buf[DS4_OUT_RUMBLE_LEFT], buf[DS4_OUT_RUMBLE_RIGHT]);
+    }
+}
+
+// Interrupt OUT endpoint - DS4 hosts send rumble/LED reports here
+static void output_report_cb(const struct device *dev, const uint16_t len, const uint8_t *const buf)
+{
+    ARG_UNUSED(dev);
+
+    if (buf && len > 0 && buf[0] == DS4_OUTPUT_REPORT_ID)
+    {
+        ds4_handle_output_report(buf, len);
+    }
+}
+
 // Feature report callback for HID Set Report requests
 static int set_report_cb(const struct device *dev, const uint8_t type, const uint8_t id,
                          const uint16_t len, const uint8_t *const buf)
@@ -534,7 +740,10 @@ static int set_report_cb(const struct device *dev, const uint8_t type, const uin
 
         case 0x05: // DS4 Output Report (rumble, LED, etc.)
             // LOG_INF("DS4 Output Report 0x05 received (rumble/LED control)");
-            // TODO: Could implement actual rumble/LED control here
+            if (buf)
+            {
+                ds4_handle_output_report(buf, len);
+            }
             break;
 
         default:
@@ -575,8 +784,10 @@ static int set_report_cb(const struct device *dev, const uint8_t type, const uin
 
 static const struct hid_device_ops ops = {
     .input_report_done = int_in_ready_cb,
+    .sof = sof_cb,
     .get_report = get_report_cb,
     .set_report = set_report_cb,
+    .output_report = output_report_cb,
 };
 
 // Initialize USB HID composite device
@@ -616,6 +827,12 @@ const struct device *usb_hid_composite_get_device(void)
     return hid_device;
 }
 
+// Register the handler for host rumble
+void usb_hid_set_rumble_callback(usb_hid_rumble_cb_t cb)
+{
+    rumble_cb = cb;
+}
+
 // Simple DS4 Report structure - matches exact byte layout
 // https://controllers.fandom.com/wiki/Sony_DualShock_4/Data_Structures#HID_Report_0x05_Output_USB/Dongle
 typedef struct __attribute__((packed))
@@ -648,6 +865,8 @@ typedef struct __attribute__((packed))
     uint8_t unknown2[21];     // Bytes 43-63: Unknown/padding
 } SimpleDS4Report;
 
+BUILD_ASSERT(sizeof(SimpleDS4Report) <= HID_IN_REPORT_MAX_SIZE, "DS4 report exceeds IN buffer");
+
 
 // Helper function to send DS4 gamepad report with touchpad and IMU data
 void usb_hid_send_ds4_report_with_touchpad_and_imu(const struct device *hid_dev, uint8_t dpad, uint8_t buttons1, uint8_t buttons2,
@@ -656,7 +875,8 @@ void usb_hid_send_ds4_report_with_touchpad_and_imu(const struct device *hid_dev,
                                                    bool touch1_active, uint16_t touch1_x, uint16_t touch1_y,
                                                    bool touch2_active, uint16_t touch2_x, uint16_t touch2_y,
                                                    int16_t accel_x, int16_t accel_y, int16_t accel_z,
-                                                   int16_t gyro_x, int16_t gyro_y, int16_t gyro_z)
+                                                   int16_t gyro_x, int16_t gyro_y, int16_t gyro_z, uint32_t imu_time_us,
+                                                   uint32_t data_age_us)
 {
     // Ensure touch slot 1 is used before slot 2 (DS4 protocol requirement)
 bool actual_touch1_active, actual_touch2_active;
@@ -736,9 +956,13 @@ if (touch1_active && touch2_active) {
     ds4_report.left_trigger = left_trigger;
     ds4_report.right_trigger = right_trigger;
 
-    // Timing counter for authenticity (bytes 10-11)
+    // Sensor timestamp (bytes 10-11) in DS4 units of 16/3us - follows the IMU sample time so the host
+    // integrates gyro over the real sample spacing (no new sample = no time passed)
+    uint64_t elapsed = (uint64_t)(imu_time_us - ds4_timestamp_imu_us) * 3 + ds4_timestamp_frac;
+    ds4_timestamp_counter += (uint16_t)(elapsed / 16);
+    ds4_timestamp_frac = elapsed % 16;
+    ds4_timestamp_imu_us = imu_time_us;
     ds4_report.timestamp = ds4_timestamp_counter;
-    ds4_timestamp_counter += 45;
 
     // Battery/USB state (byte 12)
     ds4_report.battery = 0x0B; // USB charging state
@@ -809,27 +1033,9 @@ if (touch1_active && touch2_active) {
         ds4_report.touch2_data[3] = 0;
     }
 
-    // Send the complete DS4 report
-    uint32_t usb_start = k_uptime_get_32();
-    int ret = hid_int_ep_write(hid_dev, (uint8_t *)&ds4_report, sizeof(ds4_report), NULL);
-    if (ret == 0)
-    {
-        k_sem_take(&ep_write_sem, K_FOREVER);
-        
-        // Monitor USB write timing - only log if really slow
-        uint32_t usb_time = k_uptime_get_32() - usb_start;
-        static uint32_t max_usb_time = 0;
-        if (usb_time > max_usb_time) {
-            max_usb_time = usb_time;
-            if (usb_time > 5) { // Only warn if USB write takes over 5ms (was 1ms)
-                LOG_WRN("USB write took %dms (new max)", usb_time);
-            }
-        }
-    }
-    else
-    {
-        LOG_ERR("HID write failed: %d", ret);
-    }
+    // Queue the complete DS4 report - replaces any report the host hasn't polled yet
+    hid_in_queue_report(hid_dev, HID_IN_SLOT_DS4, (const uint8_t *)&ds4_report, sizeof(ds4_report),
+                        data_age_us);
 
     // Log successful report
     // LOG_DBG("DS4 report sent with touchpad and IMU: touch1(%s), touch2(%s), gyro(%d,%d,%d)",
@@ -871,15 +1077,22 @@ void usb_hid_send_mouse_report(const struct device *hid_dev, int8_t x, int8_t y,
         wheel    // Wheel movement (-127 to 127)
     };
 
-    int ret = hid_int_ep_write(hid_dev, mouse_report, sizeof(mouse_report), NULL);
-    if (ret)
+    // Movement is relative - fold it into a report the host hasn't polled yet instead of losing it.
+    // Merge and store under one lock hold, otherwise hid_in_kick() could send the pending report in
+    // between and the same motion would go out twice
+    k_spinlock_key_t key = k_spin_lock(&hid_in_lock);
+    hid_in_slot_t *slot = &hid_in_slots[HID_IN_SLOT_MOUSE];
+    if (slot->pending)
     {
-        // LOG_DBG("Mouse HID write error: %d", ret);
-    }
-    else
-    {
-        k_sem_take(&ep_write_sem, K_FOREVER);
+        for (int i = 2; i < 5; i++)
+        {
+            mouse_report[i] = (uint8_t)CLAMP((int8_t)mouse_report[i] + (int8_t)slot->data[i], -127, 127);
+        }
     }
+    hid_in_store_report(HID_IN_SLOT_MOUSE, mouse_report, sizeof(mouse_report), USB_HID_DATA_AGE_NONE);
+    k_spin_unlock(&hid_in_lock, key);
+
+    hid_in_kick(hid_dev);
 }
 
 // Helper function to send keyboard report
@@ -892,13 +1105,6 @@ void usb_hid_send_keyboard_report(const struct device *hid_dev, uint8_t modifier
         key1, key2, key3, key4, key5, key6 // Up to 6 simultaneous keys
     };
 
-    int ret = hid_int_ep_write(hid_dev, keyboard_report, sizeof(keyboard_report), NULL);
-    if (ret)
-    {
-        // LOG_DBG("Keyboard HID write error: %d", ret);
-    }
-    else
-    {
-        k_sem_take(&ep_write_sem, K_FOREVER);
-    }
+    hid_in_queue_report(hid_dev, HID_IN_SLOT_KEYBOARD, keyboard_report, sizeof(keyboard_report),
+                        USB_HID_DATA_AGE_NONE);
 }
\ No newline at end of file
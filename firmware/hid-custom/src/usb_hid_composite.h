@@ -10,6 +10,23 @@
 #define MOUSE_REPORT_ID   201
 #define KEYBOARD_REPORT_ID 202
 
+// Passed as data age when a report isn't built from controller data
+#define USB_HID_DATA_AGE_NONE UINT32_MAX
+
+// Host rumble from DS4 output report 0x05 - left = strong (low frequency) motor, right = weak (high frequency) motor.
+// Called from the USB stack thread on every report that carries motor values.
+typedef void (*usb_hid_rumble_cb_t)(uint8_t left, uint8_t right);
+
+// IN report pipeline counters
+typedef struct {
+    uint32_t reports_sent;     // IN transfers completed by the host
+    uint32_t report_rate_hz;   // Completed transfers over the last second
+    uint32_t sof_count;        // USB start-of-frame events seen
+    uint32_t data_age_us;      // Controller data age when the last DS4 report was submitted
+    uint32_t data_age_avg_us;  // Running average of data_age_us
+    uint32_t data_age_max_us;  // Worst data age seen
+} usb_hid_report_stats_t;
+
 // Initialize USB HID composite device
 int usb_hid_composite_init(void);
 
@@ -23,7 +40,8 @@ void usb_hid_send_ds4_report_with_touchpad_and_imu(const struct device *hid_dev,
                              bool touch1_active, uint16_t touch1_x, uint16_t touch1_y,
                              bool touch2_active, uint16_t touch2_x, uint16_t touch2_y,
                              int16_t accel_x, int16_t accel_y, int16_t accel_z,
-                             int16_t gyro_x, int16_t gyro_y, int16_t gyro_z);
+                             int16_t gyro_x, int16_t gyro_y, int16_t gyro_z, uint32_t imu_time_us,
+                             uint32_t data_age_us);
 
 // Helper function to send mouse report
 void usb_hid_send_mouse_report(const struct device *hid_dev, int8_t x, int8_t y, int8_t wheel, uint8_t buttons);
@@ -31,4 +49,13 @@ void usb_hid_send_mouse_report(const struct device *hid_dev, int8_t x, int8_t y,
 // Helper function to send keyboard report  
 void usb_hid_send_keyboard_report(const struct device *hid_dev, uint8_t modifiers, uint8_t key1, uint8_t key2, uint8_t key3, uint8_t key4, uint8_t key5, uint8_t key6);
 
+// Register the handler for host rumble (NULL to disable)
+void usb_hid_set_rumble_callback(usb_hid_rumble_cb_t cb);
+
+// Block until the next USB start-of-frame; 0 on SOF, -EAGAIN on timeout
+int usb_hid_wait_for_sof(k_timeout_t timeout);
+
+// Snapshot of the IN report pipeline counters
+void usb_hid_get_report_stats(usb_hid_report_stats_t *stats);
+
 #endif // USB_HID_COMPOSITE_H
\ No newline at end of file